@@ -0,0 +1,68 @@
+include(supple_compiler_flags)
+
+function(supple_add_benchmark input_bench_file)
+  # remove parent directory path and extension
+  get_filename_component(filename ${input_bench_file} NAME_WLE)
+  get_filename_component(raw_path ${input_bench_file} DIRECTORY)
+
+  string(REGEX REPLACE ".*/cpp/bench/src/" "" shortened_path ${raw_path})
+
+  string(REPLACE "/" "-" nearly_corrected_path ${shortened_path})
+  string(REGEX REPLACE "^-" "" corrected_path ${nearly_corrected_path})
+
+  set(bench_exe_name bench-${corrected_path}-${filename})
+  string(REPLACE "-" "." bench_exe_name ${bench_exe_name})
+
+  add_executable(${bench_exe_name} ${input_bench_file})
+
+  target_link_libraries(${bench_exe_name} PRIVATE supple_compiler_flags
+                                                 Threads::Threads)
+
+  target_include_directories(
+    ${bench_exe_name} PRIVATE ${SUPPLE_TOP_DIR}/cpp/include/supple/core
+                              ${SUPPLE_TOP_DIR}/cpp/bench/include)
+
+  set_target_properties(${bench_exe_name} PROPERTIES RUNTIME_OUTPUT_DIRECTORY
+                                                     ${SUPPLE_BENCH_BIN_DIR})
+
+  target_compile_features(${bench_exe_name} PUBLIC cxx_std_17)
+
+  set_property(GLOBAL APPEND PROPERTY SUPPLE_BENCHMARKS ${bench_exe_name})
+
+endfunction()
+
+function(supple_benchmark_handling)
+  set(SUPPLE_BENCH_BIN_DIR ${CMAKE_CURRENT_BINARY_DIR}/bench)
+
+  supple_status_message("Compiling benchmarks")
+
+  add_subdirectory(${CMAKE_CURRENT_SOURCE_DIR}/cpp/bench)
+
+  # run every benchmark in sequence, appending all results to one CSV file
+  get_property(bench_exe_names GLOBAL PROPERTY SUPPLE_BENCHMARKS)
+  set(bench_results ${SUPPLE_BENCH_BIN_DIR}/results.csv)
+
+  # each benchmark prints the same CSV header, so only the first is kept
+  set(bench_commands COMMAND ${CMAKE_COMMAND} -E rm -f ${bench_results})
+  set(bench_keep_from 1)
+  foreach(bench_exe_name ${bench_exe_names})
+    list(
+      APPEND
+      bench_commands
+      COMMAND
+      sh
+      -c
+      "$<TARGET_FILE:${bench_exe_name}> | tail -n +${bench_keep_from} >> ${bench_results}"
+    )
+    set(bench_keep_from 2)
+  endforeach()
+
+  add_custom_target(
+    supple_run_benchmarks
+    ${bench_commands}
+    DEPENDS ${bench_exe_names}
+    WORKING_DIRECTORY ${SUPPLE_BENCH_BIN_DIR}
+    COMMENT "Running benchmarks, results in ${bench_results}"
+    USES_TERMINAL VERBATIM)
+
+endfunction()
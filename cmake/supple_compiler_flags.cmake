@@ -1,3 +1,5 @@
+include_guard(GLOBAL)
+
 add_library(supple_compiler_flags INTERFACE)
 
 if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
@@ -16,7 +16,8 @@ function(supple_add_test_must_not_compile input_test_file)
 
     add_executable(${test_exe_name} EXCLUDE_FROM_ALL ${input_test_file})
 
-    target_link_libraries(${test_exe_name} PRIVATE supple_compiler_flags)
+    target_link_libraries(${test_exe_name} PRIVATE supple_compiler_flags
+                                                  Threads::Threads)
 
     target_include_directories(
       ${test_exe_name} PRIVATE
@@ -58,7 +59,8 @@ function(supple_add_test input_test_file)
 
     add_executable(${test_exe_name} ${input_test_file})
 
-    target_link_libraries(${test_exe_name} PRIVATE supple_compiler_flags)
+    target_link_libraries(${test_exe_name} PRIVATE supple_compiler_flags
+                                                  Threads::Threads)
 
     target_include_directories(
       ${test_exe_name} PRIVATE ${SUPPLE_TOP_DIR}/cpp/include/supple/core
@@ -0,0 +1,148 @@
+/* {{{ doc */
+/**
+ * @file bench.hpp
+ *
+ * @brief Minimal benchmarking harness
+ *
+ * @details This header contains a small timing harness used by the
+ * benchmarks under `cpp/bench`. Results are printed to stdout
+ * as CSV, one line per measurement, so that they may be diffed
+ * or fed to other tools.
+ *
+ * This header replaces the global `operator new` and `operator delete`
+ * to count allocations, and so must be included
+ * in exactly one translation unit of a benchmark executable.
+ *
+ * @author Ethan Hancock
+ *
+ * @copyright MIT Public License
+ */
+/* }}} */
+
+#ifndef SUPPLE_BENCH_BENCH_HPP
+#define SUPPLE_BENCH_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string_view>
+
+namespace supl::bench
+{
+
+// NOLINTNEXTLINE(*non-const-global*)
+inline std::size_t allocation_count {0};
+
+/* {{{ doc */
+/**
+ * @brief Prevent the optimizer from discarding a computed value.
+ */
+/* }}} */
+template <typename T>
+inline void do_not_optimize(const T& value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    // NOLINTNEXTLINE(hicpp-no-assembler)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile auto* sink {&value};
+    static_cast<void>(sink);
+#endif
+}
+
+/* {{{ doc */
+/**
+ * @brief Print the CSV header matching the lines printed by `run`.
+ */
+/* }}} */
+inline void print_header()
+{
+    std::cout << "benchmark,size,iterations,ns_per_iteration,"
+                 "allocations_per_iteration\n";
+}
+
+/* {{{ doc */
+/**
+ * @brief Time `func`, and print the result as one CSV line.
+ *
+ * @details `func` is called repeatedly, doubling the iteration count
+ * until one batch takes at least `min_time`.
+ * Timing and allocations of the final batch are reported.
+ *
+ * @param name Name of the benchmark.
+ *
+ * @param size Problem size, such as the number of elements processed
+ * by a single call to `func`.
+ *
+ * @param func Nullary callable to be timed.
+ *
+ * @param min_time Minimum duration of the reported batch.
+ */
+/* }}} */
+template <typename Func>
+void run(
+  const std::string_view name, const std::size_t size, Func&& func,
+  const std::chrono::nanoseconds min_time = std::chrono::milliseconds {100}
+)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::size_t iterations {1};
+    std::chrono::nanoseconds elapsed {0};
+    std::size_t allocations {0};
+
+    while ( true )
+    {
+        const std::size_t allocations_before {allocation_count};
+        const auto start {clock::now()};
+
+        for ( std::size_t i {0}; i != iterations; ++i )
+        {
+            func();
+        }
+
+        elapsed     = clock::now() - start;
+        allocations = allocation_count - allocations_before;
+
+        if ( elapsed >= min_time )
+        {
+            break;
+        }
+
+        iterations *= 2;
+    }
+
+    std::cout << name << ',' << size << ',' << iterations << ','
+              << static_cast<double>(elapsed.count())
+                   / static_cast<double>(iterations)
+              << ','
+              << static_cast<double>(allocations)
+                   / static_cast<double>(iterations)
+              << '\n';
+}
+
+}  // namespace supl::bench
+
+auto operator new(std::size_t size) -> void*
+{
+    ++supl::bench::allocation_count;
+    if ( void* ptr {std::malloc(size)}; ptr != nullptr )  // NOLINT
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);  // NOLINT
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);  // NOLINT
+}
+
+#endif
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// `contains` against `std::find`, with the needle absent,
+// so the whole range is always searched
+template <typename T>
+static void bench_contains(const std::string& type, const std::size_t size)
+{
+    const std::vector<T> haystack(size, T {1});
+    const T needle {2};
+
+    const std::string prefix {"contains." + type + '.'};
+
+    supl::bench::run(
+      prefix + "std_find", size,
+      [&haystack, needle]()
+      {
+          supl::bench::do_not_optimize(
+            std::find(haystack.cbegin(), haystack.cend(), needle)
+            != haystack.cend()
+          );
+      }
+    );
+
+    supl::bench::run(
+      prefix + "supl", size,
+      [&haystack, needle]()
+      {
+          supl::bench::do_not_optimize(
+            supl::contains(haystack.cbegin(), haystack.cend(), needle)
+          );
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {64UL, 4096UL, 1048576UL} )
+    {
+        bench_contains<std::uint8_t>("uint8_t", size);
+        bench_contains<std::int16_t>("int16_t", size);
+        bench_contains<int>("int", size);
+        bench_contains<long long>("long_long", size);
+        bench_contains<float>("float", size);
+        bench_contains<double>("double", size);
+    }
+}
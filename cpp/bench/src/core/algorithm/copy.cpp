@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// `copy` and `copy_n` against `std::copy`
+template <typename T>
+static void bench_copy(const std::string& type, const std::size_t size)
+{
+    std::vector<T> input(size);
+    std::iota(input.begin(), input.end(), T {0});
+    std::vector<T> output(size);
+
+    const std::string prefix {"copy." + type + '.'};
+
+    supl::bench::run(
+      prefix + "std_copy", size,
+      [&input, &output]()
+      {
+          std::copy(input.cbegin(), input.cend(), output.begin());
+          supl::bench::do_not_optimize(output.back());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "supl_copy", size,
+      [&input, &output]()
+      {
+          supl::copy(input.cbegin(), input.cend(), output.begin());
+          supl::bench::do_not_optimize(output.back());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "supl_copy_n", size,
+      [&input, &output, size]()
+      {
+          supl::copy_n(input.cbegin(), size, output.begin());
+          supl::bench::do_not_optimize(output.back());
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {64UL, 4096UL, 1048576UL} )
+    {
+        bench_copy<char>("char", size);
+        bench_copy<int>("int", size);
+        bench_copy<double>("double", size);
+    }
+}
@@ -0,0 +1,96 @@
+#include <cstddef>
+#include <list>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+// Per-element traversal of an erased node-based range,
+// against filling blocks with one virtual call each
+template <typename Container, typename Sum>
+static void
+bench_blocks(const char* kind, const Container& input, Sum&& sum_of)
+{
+    const std::size_t size {input.size()};
+    const supl::iterator begin {input.cbegin()};
+    const supl::iterator end {input.cend()};
+
+    using value_type = typename Container::value_type;
+
+    supl::bench::run(
+      std::string {"for_each_block."} + kind + ".for_each", size,
+      [&begin, &end, &sum_of]()
+      {
+          long sum {0};
+          supl::for_each(
+            begin, end,
+            [&sum, &sum_of](const value_type& value)
+            {
+                sum += sum_of(value);
+            }
+          );
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+
+    supl::bench::run(
+      std::string {"for_each_block."} + kind + ".for_each_block", size,
+      [&begin, &end, &sum_of]()
+      {
+          long sum {0};
+          supl::for_each_block(
+            begin, end,
+            [&sum, &sum_of](
+              const value_type* data, const std::size_t count
+            )
+            {
+                for ( std::size_t i {0}; i != count; ++i )
+                {
+                    sum += sum_of(data[i]);
+                }
+            }
+          );
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        std::vector<int> vec(size);
+        std::iota(vec.begin(), vec.end(), 0);
+
+        const std::list<int> list(vec.begin(), vec.end());
+
+        std::map<int, int> map;
+        for ( const int i : vec )
+        {
+            map.emplace(i, i);
+        }
+
+        bench_blocks(
+          "list", list,
+          [](const int value)
+          {
+              return static_cast<long>(value);
+          }
+        );
+
+        bench_blocks(
+          "map", map,
+          [](const std::pair<const int, int>& value)
+          {
+              return static_cast<long>(value.second);
+          }
+        );
+    }
+}
@@ -0,0 +1,60 @@
+#include <cstddef>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// Serial against parallel `for_each_chain`,
+// over one large and several small ranges
+static void bench_chain(const std::size_t size)
+{
+    const std::vector<double> large(size, 1.5);
+    const std::vector<double> small1(size / 16, 2.5);
+    const std::vector<double> small2(size / 64, 3.5);
+    const std::vector<double> small3(size / 256, 4.5);
+
+    const auto work {[](const double value)
+                     {
+                         double result {value};
+                         for ( int i {0}; i != 16; ++i )
+                         {
+                             result = result * 1.0001 + 0.5;
+                         }
+                         supl::bench::do_not_optimize(result);
+                     }};
+
+    supl::bench::run(
+      "for_each_chain.serial", size,
+      [&]()
+      {
+          supl::for_each_chain(
+            work, large.cbegin(), large.cend(), small1.cbegin(),
+            small1.cend(), small2.cbegin(), small2.cend(), small3.cbegin(),
+            small3.cend()
+          );
+      }
+    );
+
+    supl::bench::run(
+      "for_each_chain.par", size,
+      [&]()
+      {
+          supl::for_each_chain(
+            supl::par, work, large.cbegin(), large.cend(), small1.cbegin(),
+            small1.cend(), small2.cbegin(), small2.cend(), small3.cbegin(),
+            small3.cend()
+          );
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {65536UL, 1048576UL} )
+    {
+        bench_chain(size);
+    }
+}
@@ -0,0 +1,91 @@
+#include <cstddef>
+#include <deque>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// Three-point stencil with `for_each_window`,
+// against the loop one would write by hand,
+// over contiguous and non-contiguous storage
+template <typename T>
+static void bench_window(const std::string& type, const std::size_t size)
+{
+    std::vector<T> input(size);
+    std::iota(input.begin(), input.end(), T {0});
+    const std::deque<T> deque_input(input.cbegin(), input.cend());
+    std::vector<T> output(size);
+
+    const std::string prefix {"for_each_window." + type + '.'};
+
+    supl::bench::run(
+      prefix + "hand_written", size,
+      [&input, &output, size]()
+      {
+          for ( std::size_t i {0}; i + 2 < size; ++i )
+          {
+              output[i] = input[i] + input[i + 1] + input[i + 2];
+          }
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "contiguous", size,
+      [&input, &output]()
+      {
+          T* out {output.data()};
+          supl::for_each_window<3>(
+            input.cbegin(), input.cend(),
+            [&out](const T a, const T b, const T c)
+            {
+                *out++ = a + b + c;
+            }
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "deque_hand_written", size,
+      [&deque_input, &output, size]()
+      {
+          for ( std::size_t i {0}; i + 2 < size; ++i )
+          {
+              output[i] =
+                deque_input[i] + deque_input[i + 1] + deque_input[i + 2];
+          }
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "deque_rotating", size,
+      [&deque_input, &output]()
+      {
+          T* out {output.data()};
+          supl::for_each_window<3>(
+            deque_input.cbegin(), deque_input.cend(),
+            [&out](const T a, const T b, const T c)
+            {
+                *out++ = a + b + c;
+            }
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_window<int>("int", size);
+        bench_window<double>("double", size);
+    }
+}
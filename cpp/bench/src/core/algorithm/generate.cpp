@@ -0,0 +1,60 @@
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/utility.hpp"
+
+#include "supl/bench.hpp"
+
+// Filling a buffer with uniformly distributed random values:
+// serially from a single `std::mt19937_64`,
+// and in parallel with one `counter_rng` per element
+static void bench_generate(const std::size_t size)
+{
+    std::vector<double> output(size);
+
+    supl::bench::run(
+      "generate.mt19937_64", size,
+      [&output]()
+      {
+          std::mt19937_64 rng {2024};
+          std::uniform_real_distribution<double> dist {0.0, 1.0};
+          supl::generate(
+            output.begin(), output.end(),
+            [&rng, &dist]()
+            {
+                return dist(rng);
+            }
+          );
+          supl::bench::do_not_optimize(output.back());
+      }
+    );
+
+    supl::bench::run(
+      "generate.counter_rng_par", size,
+      [&output]()
+      {
+          supl::generate(
+            supl::par, output.begin(), output.end(),
+            [](const std::size_t index)
+            {
+                supl::counter_rng rng {2024, index};
+                std::uniform_real_distribution<double> dist {0.0, 1.0};
+                return dist(rng);
+            }
+          );
+          supl::bench::do_not_optimize(output.back());
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {4096UL, 1048576UL} )
+    {
+        bench_generate(size);
+    }
+}
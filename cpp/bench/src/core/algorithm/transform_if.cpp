@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// `transform_if` against `std::copy_if` followed by `std::transform`,
+// at several selectivities, so branch prediction is exercised
+template <typename T>
+static void bench_transform_if(
+  const std::string& type, const std::size_t size, const int keep_one_in
+)
+{
+    std::vector<T> input(size);
+    std::iota(input.begin(), input.end(), T {0});
+
+    std::vector<T> output;
+    output.reserve(size);
+
+    const auto pred {[keep_one_in](const T value)
+                     {
+                         return static_cast<long>(value) % keep_one_in == 0;
+                     }};
+
+    const auto func {[](const T value)
+                     {
+                         return value * 3;
+                     }};
+
+    const std::string prefix {
+      "transform_if." + type + ".one_in_" + std::to_string(keep_one_in)
+      + '.'};
+
+    supl::bench::run(
+      prefix + "std", size,
+      [&input, &output, &pred, &func]()
+      {
+          output.clear();
+          std::copy_if(
+            input.cbegin(), input.cend(), std::back_inserter(output), pred
+          );
+          std::transform(
+            output.cbegin(), output.cend(), output.begin(), func
+          );
+          supl::bench::do_not_optimize(output.size());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "supl", size,
+      [&input, &output, &pred, &func]()
+      {
+          output.clear();
+          supl::transform_if(
+            input.cbegin(), input.cend(), std::back_inserter(output), pred,
+            func
+          );
+          supl::bench::do_not_optimize(output.size());
+      }
+    );
+
+    std::vector<T> presized_output(size);
+
+    supl::bench::run(
+      prefix + "supl_par", size,
+      [&input, &presized_output, &pred, &func]()
+      {
+          const auto output_end {supl::transform_if(
+            supl::par, input.cbegin(), input.cend(),
+            presized_output.begin(), pred, func
+          )};
+          supl::bench::do_not_optimize(output_end);
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        for ( const int keep_one_in : {1, 2, 16} )
+        {
+            bench_transform_if<int>("int", size, keep_one_in);
+            bench_transform_if<double>("double", size, keep_one_in);
+        }
+    }
+}
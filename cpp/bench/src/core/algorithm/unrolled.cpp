@@ -0,0 +1,101 @@
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// Opaque to the optimizer, so the loop around it cannot be
+// vectorized or unrolled by the compiler on its own
+template <typename T>
+[[gnu::noinline]] static auto opaque_step(const T value) -> T
+{
+    return value * T {3} + T {1};
+}
+
+// Plain and unrolled traversals with a call the compiler cannot see into
+template <typename T>
+static void bench_unrolled(const std::string& type, const std::size_t size)
+{
+    std::vector<T> input(size);
+    std::iota(input.begin(), input.end(), T {0});
+    std::vector<T> output(size);
+
+    const std::string prefix {"unrolled." + type + '.'};
+
+    supl::bench::run(
+      prefix + "transform", size,
+      [&input, &output]()
+      {
+          supl::transform(
+            input.cbegin(), input.cend(), output.begin(), opaque_step<T>
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "transform<4>", size,
+      [&input, &output]()
+      {
+          supl::transform<4>(
+            input.cbegin(), input.cend(), output.begin(), opaque_step<T>
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "transform<8>", size,
+      [&input, &output]()
+      {
+          supl::transform<8>(
+            input.cbegin(), input.cend(), output.begin(), opaque_step<T>
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "zip_apply_n", size,
+      [&input, &output, size]()
+      {
+          supl::zip_apply_n(
+            [](const T in, T& out)
+            {
+                out = opaque_step(in);
+            },
+            size, input.cbegin(), output.begin()
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "zip_apply_n<4>", size,
+      [&input, &output, size]()
+      {
+          supl::zip_apply_n<4>(
+            [](const T in, T& out)
+            {
+                out = opaque_step(in);
+            },
+            size, input.cbegin(), output.begin()
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_unrolled<int>("int", size);
+        bench_unrolled<double>("double", size);
+    }
+}
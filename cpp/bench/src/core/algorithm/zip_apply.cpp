@@ -0,0 +1,91 @@
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// `zip_apply` against the loop one would write by hand
+template <typename T>
+static void bench_zip(const std::string& type, const std::size_t size)
+{
+    std::vector<T> lhs(size);
+    std::vector<T> rhs(size);
+    std::vector<T> out(size);
+    std::iota(lhs.begin(), lhs.end(), T {0});
+    std::iota(rhs.begin(), rhs.end(), T {1});
+
+    const std::string prefix {"zip_apply." + type + '.'};
+
+    supl::bench::run(
+      prefix + "hand_written", size,
+      [&lhs, &rhs, &out, size]()
+      {
+          for ( std::size_t i {0}; i != size; ++i )
+          {
+              out[i] = lhs[i] + rhs[i];
+          }
+          supl::bench::do_not_optimize(out.back());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "zip_apply", size,
+      [&lhs, &rhs, &out]()
+      {
+          supl::zip_apply(
+            [](const T left, const T right, T& result)
+            {
+                result = left + right;
+            },
+            lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(),
+            out.begin(), out.end()
+          );
+          supl::bench::do_not_optimize(out.back());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "zip_apply_n", size,
+      [&lhs, &rhs, &out, size]()
+      {
+          supl::zip_apply_n(
+            [](const T left, const T right, T& result)
+            {
+                result = left + right;
+            },
+            size, lhs.cbegin(), rhs.cbegin(), out.begin()
+          );
+          supl::bench::do_not_optimize(out.back());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "zip_apply_n_par", size,
+      [&lhs, &rhs, &out, size]()
+      {
+          supl::zip_apply_n(
+            supl::par,
+            [](const T left, const T right, T& result)
+            {
+                result = left + right;
+            },
+            size, lhs.cbegin(), rhs.cbegin(), out.begin()
+          );
+          supl::bench::do_not_optimize(out.back());
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_zip<int>("int", size);
+        bench_zip<double>("double", size);
+    }
+}
@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+
+#include "supl/bench.hpp"
+
+// Dot product with `zip_transform_reduce`,
+// against `std::inner_product` and a hand-written loop
+static void bench_dot(const std::size_t size)
+{
+    std::vector<double> lhs(size);
+    std::vector<double> rhs(size);
+    std::iota(lhs.begin(), lhs.end(), 0.5);
+    std::iota(rhs.begin(), rhs.end(), 1.5);
+
+    supl::bench::run(
+      "zip_transform_reduce.hand_written", size,
+      [&lhs, &rhs, size]()
+      {
+          double sum {0};
+          for ( std::size_t i {0}; i != size; ++i )
+          {
+              sum += lhs[i] * rhs[i];
+          }
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+
+    supl::bench::run(
+      "zip_transform_reduce.std_inner_product", size,
+      [&lhs, &rhs]()
+      {
+          supl::bench::do_not_optimize(
+            std::inner_product(lhs.cbegin(), lhs.cend(), rhs.cbegin(), 0.0)
+          );
+      }
+    );
+
+    supl::bench::run(
+      "zip_transform_reduce.supl", size,
+      [&lhs, &rhs]()
+      {
+          supl::bench::do_not_optimize(supl::zip_transform_reduce(
+            0.0, std::plus<> {}, std::multiplies<> {}, lhs.cbegin(),
+            lhs.cend(), rhs.cbegin(), rhs.cend()
+          ));
+      }
+    );
+
+    supl::bench::run(
+      "zip_transform_reduce.supl_par", size,
+      [&lhs, &rhs]()
+      {
+          supl::bench::do_not_optimize(supl::zip_transform_reduce(
+            supl::par, 0.0, std::plus<> {}, std::multiplies<> {},
+            lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend()
+          ));
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_dot(size);
+    }
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/predicates.hpp"
+
+#include "supl/bench.hpp"
+
+// `std::count_if` with a lambda against the vectorized `fr::count_if`
+template <typename T>
+static void bench_count(const std::string& name, const std::size_t size)
+{
+    std::vector<T> input(size);
+    for ( std::size_t i {0}; i != size; ++i )
+    {
+        input[i] = static_cast<T>((i * 37) % 101);
+    }
+
+    const std::string prefix {"count." + name + "."};
+    const T threshold {50};
+
+    supl::bench::run(
+      prefix + "std_count_if", size,
+      [&input, threshold]()
+      {
+          supl::bench::do_not_optimize(std::count_if(
+            input.cbegin(), input.cend(),
+            [threshold](const T value)
+            {
+                return value < threshold;
+            }
+          ));
+      }
+    );
+
+    supl::bench::run(
+      prefix + "fr_count_if", size,
+      [&input, threshold]()
+      {
+          supl::bench::do_not_optimize(
+            supl::fr::count_if(input, supl::less_than(threshold))
+          );
+      }
+    );
+
+    supl::bench::run(
+      prefix + "std_count", size,
+      [&input, threshold]()
+      {
+          supl::bench::do_not_optimize(
+            std::count(input.cbegin(), input.cend(), threshold)
+          );
+      }
+    );
+
+    supl::bench::run(
+      prefix + "fr_count", size,
+      [&input, threshold]()
+      {
+          supl::bench::do_not_optimize(supl::fr::count(input, threshold));
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_count<std::uint8_t>("uint8", size);
+        bench_count<std::int32_t>("int32", size);
+        bench_count<float>("float", size);
+        bench_count<double>("double", size);
+    }
+}
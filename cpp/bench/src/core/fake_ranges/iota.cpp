@@ -0,0 +1,67 @@
+#include <cstddef>
+#include <string>
+
+#include "supl/fake_ranges.hpp"
+
+#include "supl/bench.hpp"
+
+// Range-for over `fr::iota` against a counted loop
+template <typename T>
+static void bench_iota(const std::string& type, const std::size_t size)
+{
+    const T end {static_cast<T>(size)};
+    const std::string prefix {"iota." + type + '.'};
+
+    supl::bench::run(
+      prefix + "raw_loop", size,
+      [end]()
+      {
+          long long sum {0};
+          for ( T i {0}; i != end; ++i )
+          {
+              sum += static_cast<long long>(i);
+              supl::bench::do_not_optimize(sum);
+          }
+      }
+    );
+
+    supl::bench::run(
+      prefix + "iota", size,
+      [end]()
+      {
+          long long sum {0};
+          for ( const T i : supl::fr::iota<T> {T {0}, end} )
+          {
+              sum += static_cast<long long>(i);
+              supl::bench::do_not_optimize(sum);
+          }
+      }
+    );
+
+    supl::bench::run(
+      prefix + "fr_for_each", size,
+      [end]()
+      {
+          long long sum {0};
+          supl::fr::for_each(
+            supl::fr::iota<T> {T {0}, end},
+            [&sum](const T i)
+            {
+                sum += static_cast<long long>(i);
+                supl::bench::do_not_optimize(sum);
+            }
+          );
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_iota<int>("int", size);
+        bench_iota<std::size_t>("size_t", size);
+    }
+}
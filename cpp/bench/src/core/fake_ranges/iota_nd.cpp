@@ -0,0 +1,87 @@
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+
+#include "supl/bench.hpp"
+
+// Matrix transpose, where one side is always read or written
+// against the grain, with nested loops and with `fr::iota_nd`
+// in row-major and tiled order
+static void bench_transpose(const std::size_t side)
+{
+    const std::size_t size {side * side};
+    std::vector<double> input(size);
+    std::iota(input.begin(), input.end(), 0.0);
+    std::vector<double> output(size);
+
+    const std::string prefix {"iota_nd.transpose."};
+
+    supl::bench::run(
+      prefix + "nested_loops", size,
+      [&input, &output, side]()
+      {
+          for ( std::size_t row {0}; row != side; ++row )
+          {
+              for ( std::size_t column {0}; column != side; ++column )
+              {
+                  output[column * side + row] = input[row * side + column];
+              }
+          }
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    const auto transpose {
+      [&input, &output, side](const std::tuple<std::size_t, std::size_t> index)
+      {
+          const auto [row, column] {index};
+          output[column * side + row] = input[row * side + column];
+      }};
+
+    supl::bench::run(
+      prefix + "row_major", size,
+      [&output, side, &transpose]()
+      {
+          supl::fr::for_each(supl::fr::iota_nd<2> {{side, side}}, transpose);
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "tiled_32", size,
+      [&output, side, &transpose]()
+      {
+          supl::fr::for_each(
+            supl::fr::iota_nd<2> {{side, side}, {32, 32}}, transpose
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "tiled_32_par", size,
+      [&output, side, &transpose]()
+      {
+          supl::fr::for_each(
+            supl::par, supl::fr::iota_nd<2> {{side, side}, {32, 32}},
+            transpose
+          );
+          supl::bench::do_not_optimize(output.front());
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t side : {64UL, 512UL, 2048UL} )
+    {
+        bench_transpose(side);
+    }
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+
+#include "supl/bench.hpp"
+
+// Sum of the squares of the even elements,
+// with a temporary vector per stage against a fused view
+static void bench_pipeline(const std::size_t size)
+{
+    std::vector<long long> input(size);
+    std::iota(input.begin(), input.end(), 0LL);
+
+    const auto is_even {[](const long long value)
+                        {
+                            return value % 2 == 0;
+                        }};
+    const auto square {[](const long long value)
+                       {
+                           return value * value;
+                       }};
+
+    const std::string prefix {"views.filter_transform."};
+
+    supl::bench::run(
+      prefix + "eager", size,
+      [&input, &is_even, &square]()
+      {
+          std::vector<long long> filtered;
+          std::copy_if(
+            input.cbegin(), input.cend(), std::back_inserter(filtered),
+            is_even
+          );
+          std::vector<long long> squared(filtered.size());
+          std::transform(
+            filtered.cbegin(), filtered.cend(), squared.begin(), square
+          );
+          supl::bench::do_not_optimize(
+            std::accumulate(squared.cbegin(), squared.cend(), 0LL)
+          );
+      }
+    );
+
+    supl::bench::run(
+      prefix + "view_range_for", size,
+      [&input, &is_even, &square]()
+      {
+          long long sum {0};
+          for ( const long long value : supl::fr::transform(
+                  supl::fr::filter(input, is_even), square
+                ) )
+          {
+              sum += value;
+          }
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+
+    supl::bench::run(
+      prefix + "view_for_each", size,
+      [&input, &is_even, &square]()
+      {
+          long long sum {0};
+          supl::fr::for_each(
+            supl::fr::transform(supl::fr::filter(input, is_even), square),
+            [&sum](const long long value)
+            {
+                sum += value;
+            }
+          );
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_pipeline(size);
+    }
+}
@@ -0,0 +1,88 @@
+#include <cstddef>
+#include <deque>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+// contiguous erased ranges are traversed through pointers,
+// other erased ranges pay a virtual call per operation
+template <typename Container>
+static void bench_algorithms(const char* kind, const Container& input)
+{
+    const std::size_t size {input.size()};
+    std::vector<int> output(size);
+
+    const supl::iterator begin {input.cbegin()};
+    const supl::iterator end {input.cend()};
+
+    const std::string prefix {std::string {"iterator."} + kind + '.'};
+
+    supl::bench::run(
+      prefix + "for_each", size,
+      [&begin, &end]()
+      {
+          long sum {0};
+          supl::for_each(
+            begin, end,
+            [&sum](const int value)
+            {
+                sum += value;
+            }
+          );
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+
+    supl::bench::run(
+      prefix + "transform", size,
+      [&begin, &end, &output]()
+      {
+          supl::transform(
+            begin, end, output.begin(),
+            [](const int value)
+            {
+                return value * 3;
+            }
+          );
+          supl::bench::do_not_optimize(output.back());
+      }
+    );
+
+    supl::bench::run(
+      prefix + "copy", size,
+      [&begin, &end, &output]()
+      {
+          supl::bench::do_not_optimize(
+            supl::copy(begin, end, output.begin())
+          );
+      }
+    );
+
+    supl::bench::run(
+      prefix + "contains", size,
+      [&begin, &end]()
+      {
+          supl::bench::do_not_optimize(supl::contains(begin, end, -1));
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        std::vector<int> vec(size);
+        std::iota(vec.begin(), vec.end(), 0);
+        const std::deque<int> deque(vec.begin(), vec.end());
+
+        bench_algorithms("contiguous", vec);
+        bench_algorithms("deque", deque);
+    }
+}
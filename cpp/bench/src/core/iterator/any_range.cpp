@@ -0,0 +1,89 @@
+#include <cstddef>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+// A pair of erased iterators pays several virtual calls per element,
+// `any_range::for_each` pays one virtual call per traversal
+template <typename Container>
+static void bench_any_range(const char* kind, const Container& input)
+{
+    const std::size_t size {input.size()};
+
+    const supl::iterator begin {input.cbegin()};
+    const supl::iterator end {input.cend()};
+    const supl::any_range range {input};
+
+    const std::string prefix {std::string {"any_range."} + kind + '.'};
+
+    supl::bench::run(
+      prefix + "iterator_pair", size,
+      [&begin, &end]()
+      {
+          long sum {0};
+          for ( auto itr {begin}; itr != end; ++itr )
+          {
+              sum += *itr;
+          }
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+
+    supl::bench::run(
+      prefix + "range_for", size,
+      [&range]()
+      {
+          long sum {0};
+          for ( const int value : range )
+          {
+              sum += value;
+          }
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+
+    supl::bench::run(
+      prefix + "for_each", size,
+      [&range]()
+      {
+          long sum {0};
+          range.for_each(
+            [&sum](const int value)
+            {
+                sum += value;
+            }
+          );
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+
+    supl::bench::run(
+      prefix + "copy", size,
+      [&range]()
+      {
+          const supl::any_range copy {range};
+          supl::bench::do_not_optimize(copy);
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        std::vector<int> vec(size);
+        std::iota(vec.begin(), vec.end(), 0);
+
+        const std::list<int> list(vec.begin(), vec.end());
+
+        bench_any_range("vector", vec);
+        bench_any_range("list", list);
+    }
+}
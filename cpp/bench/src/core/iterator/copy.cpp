@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <map>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+// Erased iterators are copied into `supl::for_each`,
+// and once more per element by post-increment
+template <typename Itr>
+static void bench_traversal(
+  const std::string_view name, const std::size_t size, Itr begin, Itr end
+)
+{
+    supl::bench::run(
+      name, size,
+      [begin, end]()
+      {
+          const supl::iterator erased_begin {begin};
+          const supl::iterator erased_end {end};
+
+          long sum {0};
+          supl::for_each(
+            erased_begin, erased_end,
+            [&sum](const auto& value)
+            {
+                sum += static_cast<long>(value);
+            }
+          );
+
+          for ( auto itr {erased_begin}; itr != erased_end; )
+          {
+              sum += static_cast<long>(*itr++);
+          }
+
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {16UL, 1024UL} )
+    {
+        std::vector<int> vec(size);
+        std::iota(vec.begin(), vec.end(), 0);
+
+        const std::deque<int> deque(vec.begin(), vec.end());
+        const std::list<int> list(vec.begin(), vec.end());
+
+        std::map<int, int> map;
+        for ( const int i : vec )
+        {
+            map.emplace(i, i);
+        }
+
+        bench_traversal(
+          "iterator.copy.pointer", size, vec.data(), vec.data() + size
+        );
+        bench_traversal(
+          "iterator.copy.vector", size, vec.cbegin(), vec.cend()
+        );
+        bench_traversal(
+          "iterator.copy.deque", size, deque.cbegin(), deque.cend()
+        );
+        bench_traversal(
+          "iterator.copy.list", size, list.cbegin(), list.cend()
+        );
+
+        supl::bench::run(
+          "iterator.copy.map", size,
+          [&map]()
+          {
+              supl::iterator itr {map.cbegin()};
+              const supl::iterator end {map.cend()};
+
+              long sum {0};
+              for ( ; itr != end; itr++ )
+              {
+                  sum += static_cast<long>(itr->second);
+              }
+
+              supl::bench::do_not_optimize(sum);
+          }
+        );
+    }
+}
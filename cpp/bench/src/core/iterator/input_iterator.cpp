@@ -0,0 +1,62 @@
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+// Streaming through an erased input iterator,
+// against the raw stream iterator
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        std::string text;
+        for ( std::size_t i {0}; i != size; ++i )
+        {
+            text += std::to_string(i);
+            text += ' ';
+        }
+
+        supl::bench::run(
+          "input_iterator.raw", size,
+          [&text]()
+          {
+              std::istringstream stream {text};
+              long sum {0};
+              supl::for_each(
+                std::istream_iterator<int> {stream},
+                std::istream_iterator<int> {},
+                [&sum](const int value)
+                {
+                    sum += value;
+                }
+              );
+              supl::bench::do_not_optimize(sum);
+          }
+        );
+
+        supl::bench::run(
+          "input_iterator.erased", size,
+          [&text]()
+          {
+              std::istringstream stream {text};
+              long sum {0};
+              supl::for_each(
+                supl::input_iterator {std::istream_iterator<int> {stream}},
+                supl::input_iterator {std::istream_iterator<int> {}},
+                [&sum](const int value)
+                {
+                    sum += value;
+                }
+              );
+              supl::bench::do_not_optimize(sum);
+          }
+        );
+    }
+}
@@ -0,0 +1,101 @@
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <numeric>
+#include <vector>
+
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+namespace
+{
+// Iterator too large for the small buffer
+struct big_iterator
+{
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = int*;
+    using reference         = int&;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    int* ptr;
+    std::array<std::byte, 64> padding {};
+
+    auto operator++() -> big_iterator&
+    {
+        ++ptr;
+        return *this;
+    }
+
+    auto operator--() -> big_iterator&
+    {
+        --ptr;
+        return *this;
+    }
+
+    auto operator*() const -> int&
+    {
+        return *ptr;
+    }
+
+    auto operator==(const big_iterator& rhs) const -> bool
+    {
+        return ptr == rhs.ptr;
+    }
+};
+}  // namespace
+
+// Post-increment copies the erased iterator, so every step allocates,
+// either from the global heap or from a request-scoped arena
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        std::vector<int> vec(size);
+        std::iota(vec.begin(), vec.end(), 0);
+
+        const auto walk {[](supl::iterator<int> itr,
+                            const supl::iterator<int>& end)
+                         {
+                             long sum {0};
+                             while ( itr != end )
+                             {
+                                 sum += *itr++;
+                             }
+                             supl::bench::do_not_optimize(sum);
+                         }};
+
+        supl::bench::run(
+          "memory_resource.heap", size,
+          [&vec, &walk]()
+          {
+              walk(
+                supl::iterator<int> {big_iterator {vec.data()}},
+                supl::iterator<int> {big_iterator {vec.data() + vec.size()}}
+              );
+          }
+        );
+
+        std::vector<std::byte> arena_buffer((size + 2) * 128);
+
+        supl::bench::run(
+          "memory_resource.monotonic", size,
+          [&vec, &walk, &arena_buffer]()
+          {
+              std::pmr::monotonic_buffer_resource arena {
+                arena_buffer.data(), arena_buffer.size(),
+                std::pmr::null_memory_resource()};
+
+              walk(
+                supl::iterator<int> {big_iterator {vec.data()}, &arena},
+                supl::iterator<int> {
+                  big_iterator {vec.data() + vec.size()}, &arena}
+              );
+          }
+        );
+    }
+}
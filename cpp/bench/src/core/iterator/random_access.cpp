@@ -0,0 +1,78 @@
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+using bidirectional =
+  supl::iterator<const int, std::bidirectional_iterator_tag>;
+using random_access =
+  supl::iterator<const int, std::random_access_iterator_tag>;
+
+template <typename Erased>
+static void bench_tier(const char* tier, const std::vector<int>& input)
+{
+    const std::size_t size {input.size()};
+    std::vector<int> output(size);
+
+    const std::string distance_name {std::string {"iterator.distance."}
+                                     + tier};
+    const std::string copy_n_name {std::string {"iterator.copy_n."}
+                                   + tier};
+    const std::string zip_name {std::string {"iterator.zip_apply_n."}
+                                + tier};
+
+    supl::bench::run(
+      distance_name, size,
+      [&input]()
+      {
+          const Erased begin {input.cbegin()};
+          const Erased end {input.cend()};
+          supl::bench::do_not_optimize(std::distance(begin, end));
+      }
+    );
+
+    supl::bench::run(
+      copy_n_name, size,
+      [&input, &output, size]()
+      {
+          supl::copy_n(Erased {input.cbegin()}, size, output.begin());
+          supl::bench::do_not_optimize(output.back());
+      }
+    );
+
+    supl::bench::run(
+      zip_name, size,
+      [&input, size]()
+      {
+          long sum {0};
+          supl::zip_apply_n(
+            [&sum](const int lhs, const int rhs)
+            {
+                sum += static_cast<long>(lhs) * rhs;
+            },
+            size, Erased {input.cbegin()}, Erased {input.cbegin()}
+          );
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        std::vector<int> input(size);
+        std::iota(input.begin(), input.end(), 0);
+
+        bench_tier<bidirectional>("bidirectional", input);
+        bench_tier<random_access>("random_access", input);
+    }
+}
@@ -0,0 +1,65 @@
+#include <cstddef>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+// Baseline cost of erasure: the same loop over raw and erased iterators
+template <typename Itr>
+static void bench_loop(
+  const std::string& name, const std::size_t size, const Itr begin,
+  const Itr end
+)
+{
+    supl::bench::run(
+      name, size,
+      [&begin, &end]()
+      {
+          double sum {0};
+          for ( auto itr {begin}; itr != end; ++itr )
+          {
+              sum += static_cast<double>(*itr);
+          }
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+}
+
+template <typename Container>
+static void bench_container(const std::string& kind, const Container& input)
+{
+    const std::string prefix {"iterator.raw." + kind + '.'};
+
+    bench_loop(prefix + "raw", input.size(), input.cbegin(), input.cend());
+    bench_loop(
+      prefix + "erased", input.size(), supl::iterator {input.cbegin()},
+      supl::iterator {input.cend()}
+    );
+}
+
+template <typename T>
+static void bench_type(const std::string& type, const std::size_t size)
+{
+    std::vector<T> vec(size);
+    std::iota(vec.begin(), vec.end(), T {0});
+
+    const std::list<T> list(vec.begin(), vec.end());
+
+    bench_container("vector_" + type, vec);
+    bench_container("list_" + type, list);
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {1024UL, 65536UL, 1048576UL} )
+    {
+        bench_type<int>("int", size);
+        bench_type<double>("double", size);
+    }
+}
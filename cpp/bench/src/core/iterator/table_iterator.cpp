@@ -0,0 +1,85 @@
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/iterators.hpp"
+
+#include "supl/bench.hpp"
+
+// Virtual dispatch through a model,
+// against function pointers stored in the wrapper
+template <template <typename> typename Erased, typename Container, typename Sum>
+static void bench_erasure(
+  const std::string& name, const Container& input, Sum&& sum_of
+)
+{
+    using value_type = const typename Container::value_type;
+
+    const Erased<value_type> begin {input.cbegin()};
+    const Erased<value_type> end {input.cend()};
+
+    supl::bench::run(
+      name, input.size(),
+      [&begin, &end, &sum_of]()
+      {
+          long sum {0};
+          for ( auto itr {begin}; itr != end; ++itr )
+          {
+              sum += sum_of(*itr);
+          }
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+}
+
+template <typename Container, typename Sum>
+static void
+bench_container(const char* kind, const Container& input, Sum&& sum_of)
+{
+    bench_erasure<supl::iterator>(
+      std::string {"table_iterator."} + kind + ".virtual", input, sum_of
+    );
+    bench_erasure<supl::table_iterator>(
+      std::string {"table_iterator."} + kind + ".table", input, sum_of
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    const auto identity {[](const int value)
+                         {
+                             return static_cast<long>(value);
+                         }};
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        std::vector<int> vec(size);
+        std::iota(vec.begin(), vec.end(), 0);
+
+        const std::deque<int> deque(vec.begin(), vec.end());
+        const std::list<int> list(vec.begin(), vec.end());
+
+        std::map<int, int> map;
+        for ( const int i : vec )
+        {
+            map.emplace(i, i);
+        }
+
+        bench_container("vector", vec, identity);
+        bench_container("deque", deque, identity);
+        bench_container("list", list, identity);
+        bench_container(
+          "map", map,
+          [](const std::pair<const int, int>& value)
+          {
+              return static_cast<long>(value.second);
+          }
+        );
+    }
+}
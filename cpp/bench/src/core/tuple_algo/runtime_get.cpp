@@ -0,0 +1,100 @@
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "supl/tuple_algo.hpp"
+
+#include "supl/bench.hpp"
+
+// `runtime_get` followed by a visit, against a hand-written switch
+template <typename Tuple>
+static void bench_runtime_get(
+  const std::string& name, Tuple& tuple, const std::size_t size
+)
+{
+    constexpr std::size_t tuple_size {std::tuple_size_v<Tuple>};
+
+    std::vector<std::size_t> indices(size);
+    for ( std::size_t i {0}; i != size; ++i )
+    {
+        indices[i] = (i * 7) % tuple_size;
+    }
+
+    supl::bench::run(
+      "runtime_get." + name, size,
+      [&tuple, &indices]()
+      {
+          double sum {0};
+          for ( const std::size_t idx : indices )
+          {
+              sum += std::visit(
+                [](const auto value)
+                {
+                    // the variant also holds an unused empty alternative
+                    if constexpr ( std::is_arithmetic_v<decltype(value)> )
+                    {
+                        return static_cast<double>(value);
+                    }
+                    else
+                    {
+                        return 0.0;
+                    }
+                },
+                supl::tuple::runtime_get(tuple, idx)
+              );
+          }
+          supl::bench::do_not_optimize(sum);
+      }
+    );
+}
+
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    std::tuple<int, double, char, long> small {1, 2.5, 'c', 4L};
+    std::tuple<int, double, char, long, short, float, unsigned, bool>
+      large {1, 2.5, 'c', 4L, 5, 6.5F, 7U, true};
+
+    for ( const std::size_t size : {1024UL, 65536UL} )
+    {
+        bench_runtime_get("size_4", small, size);
+        bench_runtime_get("size_8", large, size);
+
+        std::vector<std::size_t> indices(size);
+        for ( std::size_t i {0}; i != size; ++i )
+        {
+            indices[i] = (i * 7) % 4;
+        }
+
+        supl::bench::run(
+          "runtime_get.size_4.switch", size,
+          [&small, &indices]()
+          {
+              double sum {0};
+              for ( const std::size_t idx : indices )
+              {
+                  switch ( idx )
+                  {
+                      case 0 :
+                          sum += std::get<0>(small);
+                          break;
+                      case 1 :
+                          sum += std::get<1>(small);
+                          break;
+                      case 2 :
+                          sum += std::get<2>(small);
+                          break;
+                      default :
+                          sum += static_cast<double>(std::get<3>(small));
+                          break;
+                  }
+              }
+              supl::bench::do_not_optimize(sum);
+          }
+        );
+    }
+}
@@ -0,0 +1,63 @@
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "supl/utility.hpp"
+
+#include "supl/bench.hpp"
+
+// Stringifying nested containers, as done when tests report failures
+auto main() -> int
+{
+    supl::bench::print_header();
+
+    for ( const std::size_t size : {16UL, 256UL, 4096UL} )
+    {
+        const std::vector<int> flat(size, 42);
+        const std::vector<std::vector<int>> nested(size / 16, flat);
+
+        std::map<std::string, std::vector<double>> keyed;
+        for ( std::size_t i {0}; i != size / 16; ++i )
+        {
+            keyed.emplace(std::to_string(i), std::vector<double>(16, 0.5));
+        }
+
+        const std::vector<std::tuple<int, char, std::string>> tuples(
+          size, {1, 'a', "text"}
+        );
+
+        supl::bench::run(
+          "to_string.vector_int", size,
+          [&flat]()
+          {
+              supl::bench::do_not_optimize(supl::to_string(flat));
+          }
+        );
+
+        supl::bench::run(
+          "to_string.vector_vector_int", size * (size / 16),
+          [&nested]()
+          {
+              supl::bench::do_not_optimize(supl::to_string(nested));
+          }
+        );
+
+        supl::bench::run(
+          "to_string.map_string_vector_double", size,
+          [&keyed]()
+          {
+              supl::bench::do_not_optimize(supl::to_string(keyed));
+          }
+        );
+
+        supl::bench::run(
+          "to_string.vector_tuple", size,
+          [&tuples]()
+          {
+              supl::bench::do_not_optimize(supl::to_string(tuples));
+          }
+        );
+    }
+}
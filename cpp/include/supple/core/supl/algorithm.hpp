@@ -18,20 +18,111 @@
 #define SUPPLE_CORE_ALGORITHM_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
-#include "internal/algorithm/min_max.hpp"  //NOLINT
+#include "internal/algorithm/is_constant_evaluated.hpp"  //NOLINT
+#include "internal/algorithm/min_max.hpp"                //NOLINT
+#include "internal/algorithm/parallel.hpp"               //NOLINT
+#include "internal/algorithm/simd_find.hpp"              //NOLINT
 
+#include "iterators.hpp"
 #include "metaprogramming.hpp"
 #include "tuple_algo.hpp"
 
 namespace supl
 {
 
+namespace impl
+{
+    // Whether `itr[n]` yields `reference`.
+    // Iterators which compute their values, such as those of `fr::iota`,
+    // subscript by value, so it cannot stand in for `*(itr + n)`.
+    template <typename Itr, typename = void>
+    struct has_reference_subscript : std::false_type
+    {
+    };
+
+    template <typename Itr>
+    struct has_reference_subscript<
+      Itr, std::enable_if_t<std::is_same_v<
+             decltype(std::declval<const Itr&>()[std::declval<
+               typename std::iterator_traits<Itr>::difference_type>()]),
+             typename std::iterator_traits<Itr>::reference>>>
+            : std::true_type
+    {
+    };
+
+    // Whether `itr[n]` is cheaper than incrementing `itr` n times.
+    // True for contiguous iterators, including pointers,
+    // and for random access `supl::iterator`s,
+    // where each increment is a virtual call.
+    // Other random access iterators, such as those of `std::deque`,
+    // compute an offset per subscript, so they are incremented instead.
+    // False for types which only satisfy a minimal iterator interface,
+    // and have no `iterator_traits`,
+    // or whose subscript does not yield `reference`.
+    template <typename Itr, typename = void>
+    struct is_indexable : std::false_type
+    {
+    };
+
+    template <typename Itr>
+    struct is_indexable<
+      Itr,
+      std::void_t<typename std::iterator_traits<Itr>::iterator_category>>
+            : std::conjunction<
+                is_random_access<Itr>, has_reference_subscript<Itr>,
+                std::disjunction<
+                  is_contiguous_iterator<Itr>, is_erased_iterator<Itr>>>
+    {
+    };
+
+    template <typename Itr>
+    constexpr inline bool is_indexable_v = is_indexable<Itr>::value;
+
+    // Calls `body(i)` for each `i` in [0, n), in order,
+    // `Unroll` calls per loop iteration, then one at a time
+    template <std::size_t Unroll, typename Body, std::size_t... Idxs>
+    constexpr void unrolled_for_impl(
+      const std::size_t n, Body& body, std::index_sequence<Idxs...>
+    )
+    {
+        std::size_t i {0};
+
+        for ( ; n - i >= Unroll; i += Unroll )
+        {
+            (body(i + Idxs), ...);
+        }
+
+        for ( ; i != n; ++i )
+        {
+            body(i);
+        }
+    }
+
+    template <std::size_t Unroll, typename Body>
+    constexpr void unrolled_for(const std::size_t n, Body&& body)
+    {
+        static_assert(Unroll != 0, "Unroll factor must not be zero");
+        unrolled_for_impl<Unroll>(
+          n, body, std::make_index_sequence<Unroll> {}
+        );
+    }
+}  // namespace impl
+
 /* {{{ doc */
 /**
  * @brief Base case of recursive overload.
@@ -132,6 +223,30 @@ max_size(const Container& cont, const Containers&... conts) noexcept
     return std::max(max_size(cont), max_size(conts...));
 }
 
+/* {{{ doc */
+/**
+ * @brief Determine if a range contains a value.
+ *
+ * @details If `Itr` is a `supl::iterator` erasing a contiguous iterator,
+ * the range is searched through pointers,
+ * bypassing a virtual call per element.
+ *
+ * Contiguous ranges of integers, `float`, or `double`
+ * are searched with SIMD instructions outside of constant evaluation,
+ * where the target supports them.
+ * Otherwise, the range is searched one element at a time,
+ * and may be searched during constant evaluation.
+ *
+ * @param begin Beginning of range to search.
+ *
+ * @param end End of range to search.
+ *
+ * @param value Value to search for.
+ *
+ * @return `true` if any element compares equal to `value`,
+ * `false` otherwise.
+ */
+/* }}} */
 template <typename Itr>
 constexpr auto contains(
   const Itr begin, const Itr end,
@@ -141,7 +256,37 @@ constexpr auto contains(
     value
 ) noexcept(noexcept(std::find(begin, end, value))) -> bool
 {
-    return std::find(begin, end, value) != end;
+    if constexpr ( is_erased_iterator_v<Itr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            return ::supl::contains(span->first, span->second, value);
+        }
+    }
+    else if constexpr ( is_contiguous_iterator_v<Itr>
+                        && impl::is_simd_searchable_v<
+                          typename std::iterator_traits<Itr>::value_type> )
+    {
+        if ( ! impl::is_constant_evaluated() && begin != end )
+        {
+            const auto* const first {std::addressof(*begin)};
+            return impl::simd_contains(
+              first, first + std::distance(begin, end), value
+            );
+        }
+    }
+
+    // `std::find` is not constexpr until C++20
+    for ( Itr itr {begin}; itr != end; ++itr )
+    {
+        if ( std::equal_to<> {}(*itr, value) )
+        {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 /* {{{ doc */
@@ -202,6 +347,121 @@ constexpr void transform_if(
     }
 }
 
+/* {{{ doc */
+/**
+ * @brief Parallel version of `transform_if`.
+ *
+ * @details The input is split into chunks, one per thread.
+ * Each thread first counts the elements in its chunk satisfying `pred`.
+ * From those counts, each chunk's offset into the output is known,
+ * so each thread then transforms its matching elements
+ * directly into place.
+ * The output is identical, and identically ordered,
+ * to that of the serial `transform_if`.
+ *
+ * As `pred` is called twice on each element, it must be pure.
+ * `pred` and `func` may be called concurrently.
+ *
+ * @tparam Itr Random access iterator type.
+ *
+ * @tparam OutItr Random access iterator type.
+ * The output range must already be large enough
+ * to hold every transformed value.
+ *
+ * @param policy Execution policy, such as `supl::par`.
+ *
+ * @param begin Beginning of input range.
+ *
+ * @param end End of input range.
+ *
+ * @param output_itr Beginning of output range.
+ *
+ * @param pred Unary predicate used to determine if an input value will be
+ * transformed.
+ *
+ * @param func Unary function used to transform data.
+ *
+ * @return Iterator one past the last transformed value written.
+ */
+/* }}} */
+template <
+  typename Itr, typename OutItr, typename Predicate,
+  typename TransformFunc>
+auto transform_if(
+  const parallel_policy policy, const Itr begin, const Itr end,
+  const OutItr output_itr, Predicate&& pred, TransformFunc&& func
+) -> OutItr
+{
+    static_assert(
+      supl::is_random_access_v<Itr>,
+      "Parallel transform_if requires random access input iterators"
+    );
+    static_assert(
+      supl::is_random_access_v<OutItr>,
+      "Parallel transform_if requires random access output iterators"
+    );
+
+    const auto size {static_cast<std::size_t>(std::distance(begin, end))};
+    const std::size_t chunk_count {impl::parallel_chunk_count(policy, size)};
+
+    // one extra slot, so the prefix sum can be done in place
+    std::vector<std::size_t> offsets(chunk_count + 1);
+
+    impl::parallel_chunks(
+      size, chunk_count,
+      [begin, &offsets, &pred](
+        const std::size_t chunk, const std::size_t first,
+        const std::size_t last
+      )
+      {
+          const auto chunk_end {
+            std::next(begin, static_cast<std::ptrdiff_t>(last))};
+          std::size_t count {0};
+          for ( auto itr {std::next(begin, static_cast<std::ptrdiff_t>(first))};
+                itr != chunk_end; ++itr )
+          {
+              if ( pred(*itr) )
+              {
+                  ++count;
+              }
+          }
+          offsets[chunk + 1] = count;
+      }
+    );
+
+    // exclusive prefix sum of the counts
+    for ( std::size_t chunk {1}; chunk != offsets.size(); ++chunk )
+    {
+        offsets[chunk] += offsets[chunk - 1];
+    }
+
+    impl::parallel_chunks(
+      size, chunk_count,
+      [begin, output_itr, &offsets, &pred, &func](
+        const std::size_t chunk, const std::size_t first,
+        const std::size_t last
+      )
+      {
+          auto out {std::next(
+            output_itr, static_cast<std::ptrdiff_t>(offsets[chunk])
+          )};
+          const auto chunk_end {
+            std::next(begin, static_cast<std::ptrdiff_t>(last))};
+          for ( auto itr {std::next(begin, static_cast<std::ptrdiff_t>(first))};
+                itr != chunk_end; ++itr )
+          {
+              if ( pred(*itr) )
+              {
+                  *out = func(*itr);
+                  ++out;
+              }
+          }
+      }
+    );
+
+    return std::next(output_itr, static_cast<std::ptrdiff_t>(offsets.back()));
+}
+
 /* {{{ doc */
 /**
  * @brief Applies `func` to each adjacent pair of elements.
@@ -287,6 +547,151 @@ constexpr void for_each_adjacent_n(
     }
 }
 
+namespace impl
+{
+    template <
+      std::size_t Window_Size, typename T, typename Func,
+      std::size_t... Idxs>
+    void for_each_window_contiguous(
+      const T* const begin, const T* const end, Func& func,
+      std::index_sequence<Idxs...>
+    )
+    {
+        const auto size {static_cast<std::size_t>(end - begin)};
+        if ( size < Window_Size )
+        {
+            return;
+        }
+
+        // indexed from a single pointer, with no state carried
+        // between iterations, so the compiler is free to vectorize
+        for ( std::size_t i {0}; i != size - Window_Size + 1; ++i )
+        {
+            func(begin[i + Idxs]...);
+        }
+    }
+
+    template <
+      std::size_t Window_Size, typename Itr, typename Func,
+      std::size_t... Idxs>
+    constexpr void for_each_window_rotating(
+      Itr begin, const Itr end, Func& func, std::index_sequence<Idxs...>
+    )
+    {
+        using value_type = typename std::iterator_traits<Itr>::value_type;
+
+        // find out if there are enough elements
+        // without reading any of them
+        Itr leader {begin};
+        for ( std::size_t count {0}; count != Window_Size; ++count )
+        {
+            if ( leader == end )
+            {
+                return;
+            }
+            ++leader;
+        }
+
+        // braced initialization is sequenced left to right
+        std::array<value_type, Window_Size> window {
+          (static_cast<void>(Idxs), *begin++)...};
+
+        while ( true )
+        {
+            func(std::as_const(window[Idxs])...);
+
+            if ( leader == end )
+            {
+                return;
+            }
+
+            // `Window_Size` is known at compile time,
+            // so this is unrolled, and small windows stay in registers
+            for ( std::size_t i {0}; i + 1 != Window_Size; ++i )
+            {
+                window[i] = std::move(window[i + 1]);
+            }
+            window.back() = *leader;
+            ++leader;
+        }
+    }
+}  // namespace impl
+
+/* {{{ doc */
+/**
+ * @brief Applies `func` to each window of `Window_Size`
+ * consecutive elements.
+ *
+ * @details Generalization of `for_each_adjacent`.
+ * If the range holds fewer than `Window_Size` elements,
+ * `func` is not called.
+ *
+ * Example: `Window_Size` is 3, range is: {1, 2, 3, 4}
+ *
+ * Calls to `func` will be: `func(1, 2, 3)`, `func(2, 3, 4)`
+ *
+ * If `Itr` is contiguous, or a `supl::iterator` erasing a contiguous
+ * iterator, elements are indexed directly, which allows the loop
+ * to be vectorized. Otherwise, each element is read exactly once,
+ * and copied into a window which is shifted by one element per call.
+ *
+ * @pre `end` must be reachable by incrementing `begin`.
+ * If this precondition is not satisfied, the result is undefined.
+ *
+ * @tparam Window_Size Number of elements passed to each call of `func`.
+ * Must not be zero.
+ *
+ * @tparam Itr Forward iterator type.
+ * Its `value_type` must be copy constructible and move assignable.
+ *
+ * @tparam Func Function which takes `Window_Size` arguments, each of
+ * which must accept a const lvalue of the type the iterators point to.
+ *
+ * @param begin Iterator to the beginning of the range.
+ *
+ * @param end Iterator to the end of the range.
+ *
+ * @param func Function to apply to each window.
+ */
+/* }}} */
+template <std::size_t Window_Size, typename Itr, typename Func>
+constexpr void for_each_window(const Itr begin, const Itr end, Func&& func)
+{
+    static_assert(Window_Size != 0, "Window size must not be zero");
+
+    if constexpr ( is_erased_iterator_v<Itr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            impl::for_each_window_contiguous<Window_Size>(
+              span->first, span->second, func,
+              std::make_index_sequence<Window_Size> {}
+            );
+            return;
+        }
+    }
+    else if constexpr ( is_contiguous_iterator_v<Itr> )
+    {
+        if ( ! impl::is_constant_evaluated() )
+        {
+            if ( begin != end )
+            {
+                const auto* const first {std::addressof(*begin)};
+                impl::for_each_window_contiguous<Window_Size>(
+                  first, first + std::distance(begin, end), func,
+                  std::make_index_sequence<Window_Size> {}
+                );
+            }
+            return;
+        }
+    }
+
+    impl::for_each_window_rotating<Window_Size>(
+      begin, end, func, std::make_index_sequence<Window_Size> {}
+    );
+}
+
 /* {{{ doc */
 /**
  * @brief Applies `func` to each corresponding pair of elements.
@@ -385,6 +790,9 @@ constexpr void for_each_both(
  * @param n Maximum number of iterations.
  *
  * @param func Binary function to apply to each corresponding pair
+ *
+ * If both iterators are contiguous or random access `supl::iterator`s,
+ * they are indexed rather than incremented.
  */
 /* }}} */
 template <typename Itr1, typename Itr2, typename BinaryFunc>
@@ -392,13 +800,84 @@ constexpr void for_each_both_n(
   Itr1 begin1, Itr2 begin2, const std::size_t n, BinaryFunc&& func
 ) noexcept(noexcept(func(*begin1, *begin2)))
 {
-    for ( std::size_t count {0}; (count != n);
-          ++count, ++begin1, ++begin2 )
+    if constexpr ( impl::is_indexable_v<Itr1>
+                   && impl::is_indexable_v<Itr2> )
     {
-        func(*begin1, *begin2);
+        for ( std::size_t count {0}; count != n; ++count )
+        {
+            func(
+              begin1[static_cast<std::ptrdiff_t>(count)],
+              begin2[static_cast<std::ptrdiff_t>(count)]
+            );
+        }
+    }
+    else
+    {
+        for ( std::size_t count {0}; (count != n);
+              ++count, ++begin1, ++begin2 )
+        {
+            func(*begin1, *begin2);
+        }
     }
 }
 
+/* {{{ doc */
+/**
+ * @brief Parallel version of `for_each_both_n`.
+ *
+ * @details `[0, n)` is split into one chunk per thread.
+ * Chunk boundaries are placed so that, if both ranges begin
+ * on a cache line, no cache line is shared between threads.
+ * `func` may be called concurrently, and in no particular order.
+ *
+ * @tparam Itr1 Random access iterator type.
+ *
+ * @tparam Itr2 Random access iterator type.
+ *
+ * @param policy Execution policy, such as `supl::par`.
+ *
+ * @param begin1 Beginning of first range.
+ *
+ * @param begin2 Beginning of second range.
+ *
+ * @param n Number of elements to visit.
+ * Must not be greater than the size of either range.
+ *
+ * @param func Binary function to apply to each pair of elements.
+ */
+/* }}} */
+template <typename Itr1, typename Itr2, typename BinaryFunc>
+void for_each_both_n(
+  const parallel_policy policy, const Itr1 begin1, const Itr2 begin2,
+  const std::size_t n, BinaryFunc&& func
+)
+{
+    static_assert(
+      supl::is_random_access_v<Itr1> && supl::is_random_access_v<Itr2>,
+      "Parallel for_each_both_n requires random access iterators"
+    );
+
+    constexpr std::size_t granularity {
+      impl::parallel_cache_line_granularity<
+        typename std::iterator_traits<Itr1>::value_type,
+        typename std::iterator_traits<Itr2>::value_type>};
+
+    impl::parallel_chunks(
+      n, impl::parallel_chunk_count(policy, n, granularity),
+      [begin1, begin2, &func](
+        const std::size_t, const std::size_t first, const std::size_t last
+      )
+      {
+          for_each_both_n(
+            std::next(begin1, static_cast<std::ptrdiff_t>(first)),
+            std::next(begin2, static_cast<std::ptrdiff_t>(first)),
+            last - first, func
+          );
+      },
+      granularity
+    );
+}
+
 /* {{{ doc */
 /**
  * @brief Applies `func` to members of
@@ -430,6 +909,9 @@ constexpr void for_each_both_n(
  * @param begins Iterators to containers to be iterated over.
  * Smallest distance from any to its corresponding end must not be less
  * than `n`, or behavior will be undefined.
+ *
+ * If all iterators are contiguous or random access `supl::iterator`s,
+ * they are indexed rather than incremented.
  */
 /* }}} */
 template <typename VarFunc, typename... Begins>
@@ -437,13 +919,113 @@ constexpr void
 zip_apply_n(VarFunc&& func, const std::size_t n, Begins... begins)
   noexcept(noexcept(func(*begins...)))
 {
-    for ( std::size_t i {0}; i != n; ++i )
+    if constexpr ( (impl::is_indexable_v<Begins> && ...) )
+    {
+        for ( std::size_t i {0}; i != n; ++i )
+        {
+            func(begins[static_cast<std::ptrdiff_t>(i)]...);
+        }
+    }
+    else
+    {
+        for ( std::size_t i {0}; i != n; ++i )
+        {
+            func(*begins...);
+            (++begins, ...);
+        }
+    }
+}
+
+/* {{{ doc */
+/**
+ * @brief `zip_apply_n`, with the loop unrolled by `Unroll`.
+ *
+ * @details If all iterators are contiguous
+ * or random access `supl::iterator`s,
+ * `Unroll` sets of elements are visited per loop iteration,
+ * and any remainder one at a time, in order.
+ * Otherwise, equivalent to `zip_apply_n`.
+ *
+ * Usage: `supl::zip_apply_n<4>(func, n, begins...)`
+ *
+ * @tparam Unroll Number of elements per loop iteration.
+ * Must not be zero.
+ */
+/* }}} */
+template <std::size_t Unroll, typename VarFunc, typename... Begins>
+constexpr void
+zip_apply_n(VarFunc&& func, const std::size_t n, Begins... begins)
+  noexcept(noexcept(func(*begins...)))
+{
+    if constexpr ( (impl::is_indexable_v<Begins> && ...) )
+    {
+        impl::unrolled_for<Unroll>(
+          n,
+          [&func, begins...](const std::size_t i)
+          {
+              func(begins[static_cast<std::ptrdiff_t>(i)]...);
+          }
+        );
+    }
+    else
     {
-        func(*begins...);
-        (++begins, ...);
+        ::supl::zip_apply_n(std::forward<VarFunc>(func), n, begins...);
     }
 }
 
+/* {{{ doc */
+/**
+ * @brief Parallel version of `zip_apply_n`.
+ *
+ * @details `[0, n)` is split into one chunk per thread,
+ * and every iterator in `begins` is advanced to the start of each chunk.
+ * Chunk boundaries are placed so that, if all ranges begin
+ * on a cache line, no cache line is shared between threads.
+ * `func` may be called concurrently, and in no particular order.
+ *
+ * @tparam Begins Random access iterator types.
+ *
+ * @param policy Execution policy, such as `supl::par`.
+ *
+ * @param func A function which accepts the types of all the containers
+ * in parameter order.
+ *
+ * @param n Number of elements to visit.
+ * Must not be greater than the size of the smallest container.
+ *
+ * @param begins Iterators to containers to be iterated over.
+ */
+/* }}} */
+template <typename VarFunc, typename... Begins>
+void zip_apply_n(
+  const parallel_policy policy, VarFunc&& func, const std::size_t n,
+  const Begins... begins
+)
+{
+    static_assert(
+      (supl::is_random_access_v<Begins> && ...),
+      "Parallel zip_apply_n requires random access iterators"
+    );
+
+    constexpr std::size_t granularity {
+      impl::parallel_cache_line_granularity<
+        typename std::iterator_traits<Begins>::value_type...>};
+
+    impl::parallel_chunks(
+      n, impl::parallel_chunk_count(policy, n, granularity),
+      [&func, begins...](
+        const std::size_t, const std::size_t first, const std::size_t last
+      )
+      {
+          zip_apply_n(
+            func, last - first,
+            std::next(begins, static_cast<std::ptrdiff_t>(first))...
+          );
+      },
+      granularity
+    );
+}
+
 namespace impl
 {
 
@@ -466,6 +1048,29 @@ namespace impl
         );
     }
 
+    // Smallest distance from any iterator in `begins`
+    // to its corresponding iterator in `ends`
+    template <typename Tuple1, typename Tuple2, std::size_t... Idxs>
+    constexpr auto tuple_min_distance_impl(
+      const Tuple1& begins, const Tuple2& ends, std::index_sequence<Idxs...>
+    ) noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(std::min(
+          {std::distance(std::get<Idxs>(begins), std::get<Idxs>(ends))...}
+        ));
+    }
+
+    template <typename Tuple1, typename Tuple2>
+    constexpr auto
+    tuple_min_distance(const Tuple1& begins, const Tuple2& ends) noexcept
+      -> std::size_t
+    {
+        static_assert(tl::size_v<Tuple1> == tl::size_v<Tuple2>);
+        return tuple_min_distance_impl(
+          begins, ends, std::make_index_sequence<tl::size_v<Tuple1>> {}
+        );
+    }
+
 }  // namespace impl
 
 /* {{{ doc */
@@ -505,6 +1110,11 @@ namespace impl
  * @param func Callable to invoke with each set of range elements
  *
  * @param iterators Pack of iterators satisfying preconditions
+ *
+ * If all iterators are contiguous or random access `supl::iterator`s,
+ * the length of the shortest range is computed once,
+ * and iteration is deferred to `zip_apply_n`,
+ * rather than checking every iterator against its end on each step.
  */
 /* }}} */
 template <typename VarFunc, typename... Iterators>
@@ -525,44 +1135,579 @@ constexpr void zip_apply(VarFunc&& func, Iterators... iterators) noexcept
       "Begin-end pairs must be the same type of iterator"
     );
 
-    for ( auto [begins, ends] {tuple::alternating_split(
-            std::tuple<Iterators&...> {iterators...}
-          )};
-          not impl::tuple_elementwise_compare_any(begins, ends);
-          tuple::for_each(
-            begins,
-            [](auto& iterator)
-            {
-                ++iterator;
-            }
-          ) )
+    if constexpr ( sizeof...(Iterators) != 0
+                   && (impl::is_indexable_v<Iterators> && ...) )
     {
+        const auto [begins, ends] {tuple::alternating_split(
+          std::tuple<Iterators&...> {iterators...}
+        )};
+
         std::apply(
-          [&func](auto&&... iterators_inner
-          ) mutable noexcept(noexcept(func(*iterators_inner...)))
+          [&func, n {impl::tuple_min_distance(begins, ends)}](
+            const auto&... begins_inner
+          ) noexcept
           {
-              return func(*iterators_inner...);
+              zip_apply_n(func, n, begins_inner...);
           },
           begins
         );
     }
+    else
+    {
+        for ( auto [begins, ends] {tuple::alternating_split(
+                std::tuple<Iterators&...> {iterators...}
+              )};
+              not impl::tuple_elementwise_compare_any(begins, ends);
+              tuple::for_each(
+                begins,
+                [](auto& iterator)
+                {
+                    ++iterator;
+                }
+              ) )
+        {
+            std::apply(
+              [&func](auto&&... iterators_inner
+              ) mutable noexcept(noexcept(func(*iterators_inner...)))
+              {
+                  return func(*iterators_inner...);
+              },
+              begins
+            );
+        }
+    }
+}
+
+namespace impl
+{
+    // Elements per block in `zip_transform_reduce`.
+    // Blocks are reduced in order, and the results of blocks
+    // are combined pairwise.
+    constexpr inline std::size_t zip_reduce_block_size {128};
+
+    // Combines values pushed in order as a balanced binary tree,
+    // using one slot per level, like a binary counter.
+    // The shape of the tree depends only on how many values are pushed.
+    template <typename T, typename ReduceFunc>
+    class pairwise_reducer
+    {
+    private:
+
+        std::array<std::optional<T>, std::numeric_limits<std::size_t>::digits>
+          m_levels {};
+
+        ReduceFunc& m_reduce;
+
+    public:
+
+        explicit pairwise_reducer(ReduceFunc& reduce) noexcept
+                : m_reduce {reduce}
+        {
+        }
+
+        void push(T value)
+        {
+            std::size_t level {0};
+            for ( ; m_levels[level].has_value(); ++level )
+            {
+                value = m_reduce(std::move(*m_levels[level]), std::move(value));
+                m_levels[level].reset();
+            }
+            m_levels[level].emplace(std::move(value));
+        }
+
+        [[nodiscard]] auto finish(T init) -> T
+        {
+            // higher levels hold earlier values
+            std::optional<T> result {};
+            for ( std::optional<T>& level : m_levels )
+            {
+                if ( level.has_value() )
+                {
+                    result = result.has_value()
+                             ? m_reduce(std::move(*level), std::move(*result))
+                             : std::move(*level);
+                }
+            }
+
+            return result.has_value()
+                   ? m_reduce(std::move(init), std::move(*result))
+                   : init;
+        }
+    };
+
+    // Reduces `count` elements, `count` not zero, in order.
+    // Advances every iterator past the block.
+    template <
+      typename T, typename ReduceFunc, typename TransformFunc,
+      typename... Itrs>
+    auto zip_transform_reduce_block(
+      ReduceFunc& reduce, TransformFunc& transform, const std::size_t count,
+      Itrs&... itrs
+    ) -> T
+    {
+        T result(transform(*itrs...));
+        (++itrs, ...);
+
+        for ( std::size_t i {1}; i != count; ++i )
+        {
+            result = reduce(std::move(result), transform(*itrs...));
+            (++itrs, ...);
+        }
+
+        return result;
+    }
+
+    template <typename... Itrs>
+    constexpr auto zip_min_distance(Itrs... iterators) -> std::size_t
+    {
+        static_assert(
+          sizeof...(Itrs) % 2 == 0, "Expected even number of iterators"
+        );
+        static_assert(sizeof...(Itrs) != 0, "Expected at least one range");
+
+        const auto split {
+          tuple::alternating_split(std::tuple<Itrs&...> {iterators...})};
+
+        return tuple_min_distance(split.first, split.second);
+    }
+}  // namespace impl
+
+/* {{{ doc */
+/**
+ * @brief Transforms corresponding elements of several ranges,
+ * and reduces the results.
+ *
+ * @details Equivalent to `reduce(init, transform(*begins...))`
+ * folded over the first `n` elements of every range, but bracketed
+ * differently: blocks of consecutive elements are reduced in order,
+ * and the results of blocks are combined as a balanced binary tree.
+ * Each block holds 128 elements, so for floating-point sums the worst-case
+ * relative rounding error is O((128 + log(n / 128)) * epsilon),
+ * rather than O(n * epsilon).
+ * Operands are never reordered, so `reduce` need only be associative.
+ * The bracketing depends only on `n`, so the result is reproducible,
+ * and identical to that of the parallel overload.
+ *
+ * Example: dot product
+ * `zip_transform_reduce_n(0.0, std::plus<> {}, std::multiplies<> {},
+ * a.size(), a.begin(), b.begin())`
+ *
+ * @tparam T Type of the result.
+ * Must be move constructible and move assignable.
+ *
+ * @tparam ReduceFunc Associative binary function, accepting
+ * two `T`s, or a `T` followed by the result of `transform`,
+ * and returning a value convertible to `T`.
+ *
+ * @tparam TransformFunc Function which accepts the value types
+ * of all ranges in parameter order.
+ *
+ * @param init Initial value, reduced with the result
+ * of every other element.
+ *
+ * @param reduce Binary reduction.
+ *
+ * @param transform Function applied to each set of elements.
+ *
+ * @param n Number of elements of each range to visit.
+ * Must not be greater than the size of the smallest range.
+ *
+ * @param begins Iterators to the beginnings of the ranges.
+ *
+ * @return `init` if `n` is zero, otherwise the reduction.
+ */
+/* }}} */
+template <
+  typename T, typename ReduceFunc, typename TransformFunc,
+  typename... Begins>
+auto zip_transform_reduce_n(
+  T init, ReduceFunc&& reduce, TransformFunc&& transform,
+  const std::size_t n, Begins... begins
+) -> T
+{
+    impl::pairwise_reducer<T, ReduceFunc> reducer {reduce};
+
+    for ( std::size_t first {0}; first < n;
+          first += impl::zip_reduce_block_size )
+    {
+        reducer.push(impl::zip_transform_reduce_block<T>(
+          reduce, transform,
+          std::min(impl::zip_reduce_block_size, n - first), begins...
+        ));
+    }
+
+    return reducer.finish(std::move(init));
+}
+
+/* {{{ doc */
+/**
+ * @brief Transforms corresponding elements of several ranges,
+ * and reduces the results.
+ * Iteration ceases when any range runs out of elements.
+ *
+ * @details See `zip_transform_reduce_n` for how the reduction
+ * is bracketed. The length of the shortest range is measured first,
+ * which walks any range which is not random access.
+ *
+ * @pre Must be passed a pack of matching iterator pairs.
+ * ex. `zip_transform_reduce(init, reduce, transform,
+ * begin1, end1, begin2, end2)`
+ *
+ * @param init Initial value, reduced with the result
+ * of every other element.
+ *
+ * @param reduce Associative binary reduction.
+ *
+ * @param transform Function applied to each set of elements.
+ *
+ * @param iterators Pack of iterators in begin-end pairs
+ */
+/* }}} */
+template <
+  typename T, typename ReduceFunc, typename TransformFunc,
+  typename... Iterators>
+auto zip_transform_reduce(
+  T init, ReduceFunc&& reduce, TransformFunc&& transform,
+  Iterators... iterators
+) -> T
+{
+    const std::size_t n {impl::zip_min_distance(iterators...)};
+
+    return std::apply(
+      [&init, &reduce, &transform, n](const auto&... begins)
+      {
+          return zip_transform_reduce_n(
+            std::move(init), reduce, transform, n, begins...
+          );
+      },
+      tuple::alternating_split(std::tuple<Iterators&...> {iterators...})
+        .first
+    );
+}
+
+/* {{{ doc */
+/**
+ * @brief Parallel version of `zip_transform_reduce_n`.
+ *
+ * @details Blocks are reduced in parallel, and the results of blocks
+ * combined exactly as in the serial version,
+ * so the result is identical to the serial version's,
+ * however many threads are used.
+ *
+ * `reduce` and `transform` may be called concurrently.
+ *
+ * @tparam Begins Random access iterator types.
+ *
+ * @param policy Execution policy, such as `supl::par`.
+ */
+/* }}} */
+template <
+  typename T, typename ReduceFunc, typename TransformFunc,
+  typename... Begins>
+auto zip_transform_reduce_n(
+  const parallel_policy policy, T init, ReduceFunc&& reduce,
+  TransformFunc&& transform, const std::size_t n, const Begins... begins
+) -> T
+{
+    static_assert(
+      (supl::is_random_access_v<Begins> && ...),
+      "Parallel zip_transform_reduce_n requires random access iterators"
+    );
+
+    const std::size_t block_count {
+      (n + impl::zip_reduce_block_size - 1) / impl::zip_reduce_block_size};
+
+    std::vector<std::optional<T>> partials(block_count);
+
+    impl::parallel_chunks(
+      block_count,
+      std::min(
+        impl::parallel_chunk_count(policy, n),
+        std::max(block_count, std::size_t {1})
+      ),
+      [&partials, &reduce, &transform, n, begins...](
+        const std::size_t, const std::size_t first_block,
+        const std::size_t last_block
+      )
+      {
+          for ( std::size_t block {first_block}; block != last_block;
+                ++block )
+          {
+              const std::size_t first {block * impl::zip_reduce_block_size};
+              const auto count {
+                std::min(impl::zip_reduce_block_size, n - first)};
+
+              std::tuple itrs {
+                std::next(begins, static_cast<std::ptrdiff_t>(first))...};
+
+              partials[block].emplace(std::apply(
+                [&reduce, &transform, count](auto&... itrs_inner)
+                {
+                    return impl::zip_transform_reduce_block<T>(
+                      reduce, transform, count, itrs_inner...
+                    );
+                },
+                itrs
+              ));
+          }
+      }
+    );
+
+    impl::pairwise_reducer<T, ReduceFunc> reducer {reduce};
+    for ( std::optional<T>& partial : partials )
+    {
+        reducer.push(std::move(*partial));
+    }
+
+    return reducer.finish(std::move(init));
+}
+
+/* {{{ doc */
+/**
+ * @brief Parallel version of `zip_transform_reduce`.
+ *
+ * @details See the parallel `zip_transform_reduce_n`.
+ *
+ * @param policy Execution policy, such as `supl::par`.
+ */
+/* }}} */
+template <
+  typename T, typename ReduceFunc, typename TransformFunc,
+  typename... Iterators>
+auto zip_transform_reduce(
+  const parallel_policy policy, T init, ReduceFunc&& reduce,
+  TransformFunc&& transform, Iterators... iterators
+) -> T
+{
+    const std::size_t n {impl::zip_min_distance(iterators...)};
+
+    return std::apply(
+      [policy, &init, &reduce, &transform, n](const auto&... begins)
+      {
+          return zip_transform_reduce_n(
+            policy, std::move(init), reduce, transform, n, begins...
+          );
+      },
+      tuple::alternating_split(std::tuple<Iterators&...> {iterators...})
+        .first
+    );
 }
 
 /* {{{ doc */
 /**
  * @brief constexpr re-implementation of `std::for_each`
+ *
+ * @details If `Itr` is a `supl::iterator` erasing a contiguous iterator,
+ * the range is traversed through pointers,
+ * bypassing a virtual call per element.
  */
 /* }}} */
 template <typename Itr, typename Func>
 constexpr void for_each(Itr begin, const Itr end, Func&& func)
   noexcept(noexcept(func(*begin)))
 {
+    if constexpr ( is_erased_iterator_v<Itr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            ::supl::for_each(
+              span->first, span->second, std::forward<Func>(func)
+            );
+            return;
+        }
+    }
+
     for ( ; begin != end; ++begin )
     {
         func(*begin);
     }
 }
 
+/* {{{ doc */
+/**
+ * @brief `for_each`, with the loop unrolled by `Unroll`.
+ *
+ * @details If `Itr` is contiguous or a random access `supl::iterator`,
+ * `Unroll` elements are visited per loop iteration,
+ * and any remainder one at a time.
+ * A `supl::iterator` erasing a contiguous iterator
+ * is traversed through pointers.
+ * Elements are visited in order.
+ * Useful when `func` is opaque to the optimizer,
+ * so the loop would not otherwise be unrolled.
+ * Otherwise, equivalent to `for_each`.
+ *
+ * Usage: `supl::for_each<4>(begin, end, func)`
+ *
+ * @tparam Unroll Number of elements per loop iteration.
+ * Must not be zero.
+ */
+/* }}} */
+template <std::size_t Unroll, typename Itr, typename Func>
+constexpr void for_each(Itr begin, const Itr end, Func&& func)
+  noexcept(noexcept(func(*begin)))
+{
+    if constexpr ( is_erased_iterator_v<Itr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            ::supl::for_each<Unroll>(
+              span->first, span->second, std::forward<Func>(func)
+            );
+            return;
+        }
+    }
+
+    if constexpr ( impl::is_indexable_v<Itr> )
+    {
+        impl::unrolled_for<Unroll>(
+          static_cast<std::size_t>(std::distance(begin, end)),
+          [begin, &func](const std::size_t i)
+          {
+              func(begin[static_cast<std::ptrdiff_t>(i)]);
+          }
+        );
+    }
+    else
+    {
+        ::supl::for_each(begin, end, std::forward<Func>(func));
+    }
+}
+
+/* {{{ doc */
+/**
+ * @brief Applies `func` to consecutive blocks of elements of a range.
+ *
+ * @details `func` is called as `func(data, count)`,
+ * where `data` is a `const value_type*` to `count` consecutive elements,
+ * and `0 < count <= Block_Size`.
+ * Blocks are passed in order, and together cover the whole range.
+ *
+ * If the range is contiguous, blocks point directly into the range.
+ * Otherwise, elements are copied into a buffer of `Block_Size` elements,
+ * which is reused for each block.
+ * If `Itr` is a `supl::iterator`, each block is filled
+ * by a single virtual call, rather than several virtual calls per element.
+ *
+ * @pre `end` must be reachable by incrementing `begin`.
+ * If this precondition is not satisfied, the result is undefined.
+ *
+ * @tparam Block_Size Maximum number of elements passed to `func` at once.
+ *
+ * @tparam Itr Iterator type. Its `value_type` must be copy constructible,
+ * unless the range is contiguous.
+ *
+ * @tparam Func Callable accepting a `const value_type*`
+ * and a `std::size_t`.
+ *
+ * @param begin Beginning of the range.
+ *
+ * @param end End of the range.
+ *
+ * @param func Callable to apply to each block.
+ */
+/* }}} */
+template <std::size_t Block_Size = 64, typename Itr, typename Func>
+void for_each_block(Itr begin, const Itr end, Func&& func)
+{
+    static_assert(Block_Size != 0, "Block size must not be zero");
+
+    // the buffer is constructed into, so it must not be `const`
+    using value_type =
+      std::remove_cv_t<typename std::iterator_traits<Itr>::value_type>;
+
+    if constexpr ( is_erased_iterator_v<Itr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            ::supl::for_each_block<Block_Size>(
+              static_cast<const value_type*>(span->first),
+              static_cast<const value_type*>(span->second),
+              std::forward<Func>(func)
+            );
+            return;
+        }
+    }
+
+    if constexpr ( is_contiguous_iterator_v<Itr> )
+    {
+        if ( begin == end )
+        {
+            return;
+        }
+
+        const value_type* data {std::addressof(*begin)};
+        auto remaining {
+          static_cast<std::size_t>(std::distance(begin, end))
+        };
+
+        while ( remaining != 0 )
+        {
+            const std::size_t count {std::min(remaining, Block_Size)};
+            func(data, count);
+            data += count;
+            remaining -= count;
+        }
+    }
+    else
+    {
+        // Raw storage, so `value_type` need not be default constructible
+        alignas(value_type)
+          std::array<std::byte, sizeof(value_type) * Block_Size> storage;
+        value_type* const buffer {
+          static_cast<value_type*>(static_cast<void*>(storage.data()))
+        };
+
+        while ( true )
+        {
+            std::size_t count {0};
+
+            if constexpr ( is_erased_iterator_v<Itr> )
+            {
+                count = begin.next_block(buffer, Block_Size, end);
+            }
+            else
+            {
+                try
+                {
+                    for ( ; count != Block_Size && begin != end;
+                          ++count, ++begin )
+                    {
+                        ::new (static_cast<void*>(buffer + count))
+                          value_type(*begin);
+                    }
+                }
+                catch ( ... )
+                {
+                    std::destroy_n(buffer, count);
+                    throw;
+                }
+            }
+
+            if ( count == 0 )
+            {
+                return;
+            }
+
+            try
+            {
+                func(static_cast<const value_type*>(buffer), count);
+            }
+            catch ( ... )
+            {
+                std::destroy_n(buffer, count);
+                throw;
+            }
+
+            std::destroy_n(buffer, count);
+        }
+    }
+}
+
 namespace impl
 {
     template <typename Func, typename Itr_Tuple, std::size_t... Idxs>
@@ -636,6 +1781,187 @@ constexpr void for_each_chain(Func&& func, Iterators... iterators)
     );
 }
 
+namespace impl
+{
+    // Part of one range of a parallel `for_each_chain`.
+    // Ranges which are not random access are never split,
+    // so are always a single task covering the whole range.
+    struct parallel_chain_task
+    {
+        std::size_t range;
+        std::size_t first;
+        std::size_t last;
+    };
+
+    // Tasks per worker in a parallel `for_each_chain`.
+    // Splitting work more finely than one piece per worker
+    // lets workers which finish early take work from longer ranges.
+    constexpr inline std::size_t parallel_chain_tasks_per_thread {8};
+
+    template <typename Itr, typename Func>
+    void for_each_chain_task(
+      const Itr begin, const Itr end, const parallel_chain_task& task,
+      Func& func
+    )
+    {
+        if constexpr ( is_random_access_v<Itr> )
+        {
+            ::supl::for_each(
+              std::next(begin, static_cast<std::ptrdiff_t>(task.first)),
+              std::next(begin, static_cast<std::ptrdiff_t>(task.last)), func
+            );
+        }
+        else
+        {
+            ::supl::for_each(begin, end, func);
+        }
+    }
+
+    template <
+      typename Func, typename Itr_Tuple1, typename Itr_Tuple2,
+      std::size_t... Idxs>
+    void for_each_chain_parallel_impl(
+      const parallel_policy policy, Func& func, const Itr_Tuple1& begins,
+      const Itr_Tuple2& ends, std::index_sequence<Idxs...>
+    )
+    {
+        const std::array<std::size_t, sizeof...(Idxs)> sizes {
+          static_cast<std::size_t>(
+            std::distance(std::get<Idxs>(begins), std::get<Idxs>(ends))
+          )...};
+
+        std::size_t total {0};
+        for ( const std::size_t size : sizes )
+        {
+            total += size;
+        }
+
+        const std::size_t worker_count {parallel_chunk_count(policy, total)};
+        const std::size_t grain {std::max(
+          total / (worker_count * parallel_chain_tasks_per_thread),
+          std::size_t {1}
+        )};
+
+        std::vector<parallel_chain_task> tasks;
+
+        const auto add_tasks {
+          [&tasks, &sizes,
+           grain](const std::size_t range, const bool splittable)
+          {
+              const std::size_t size {sizes[range]};
+
+              if ( ! splittable )
+              {
+                  if ( size != 0 )
+                  {
+                      tasks.push_back({range, 0, size});
+                  }
+                  return;
+              }
+
+              for ( std::size_t first {0}; first < size; first += grain )
+              {
+                  tasks.push_back(
+                    {range, first, std::min(first + grain, size)}
+                  );
+              }
+          }
+        };
+
+        (add_tasks(
+           Idxs, is_random_access_v<
+                   remove_cvref_t<std::tuple_element_t<Idxs, Itr_Tuple1>>>
+         ),
+         ...);
+
+        std::atomic<std::size_t> next_task {0};
+        std::atomic<bool> failed {false};
+
+        // each "chunk" is a worker, which takes tasks until none remain
+        parallel_chunks(
+          worker_count, worker_count,
+          [&func, &begins, &ends, &tasks, &next_task,
+           &failed](const std::size_t, const std::size_t, const std::size_t)
+          {
+              try
+              {
+                  for ( std::size_t task {next_task++};
+                        task < tasks.size() && ! failed;
+                        task = next_task++ )
+                  {
+                      ((tasks[task].range == Idxs
+                          ? for_each_chain_task(
+                            std::get<Idxs>(begins), std::get<Idxs>(ends),
+                            tasks[task], func
+                          )
+                          : void()),
+                       ...);
+                  }
+              }
+              catch ( ... )
+              {
+                  failed = true;
+                  throw;
+              }
+          }
+        );
+    }
+}  // namespace impl
+
+/* {{{ doc */
+/**
+ * @brief Parallel version of `for_each_chain`.
+ *
+ * @details The chained ranges are treated as one pool of work.
+ * Random access ranges are cut into several tasks per thread,
+ * while other ranges are each a single task.
+ * Threads take tasks from the pool until it is empty,
+ * so threads which finish early help with longer ranges.
+ *
+ * `func` may be called concurrently, and in no particular order.
+ * If `func` throws, remaining tasks may not be run,
+ * and one of the thrown exceptions is rethrown once all threads
+ * have stopped.
+ *
+ * The size of every range is measured up front,
+ * which walks any range which is not random access.
+ *
+ * @param policy Execution policy, such as `supl::par`.
+ *
+ * @param func Unary callable invocable with the value type of each input range
+ *
+ * @param iterators Pack of iterators in begin-end pairs
+ */
+/* }}} */
+template <typename Func, typename... Iterators>
+void for_each_chain(
+  const parallel_policy policy, Func&& func, Iterators... iterators
+)
+{
+    static_assert(
+      sizeof...(Iterators) % 2 == 0, "Expected even number of iterators"
+    );
+
+    static_assert(
+      std::is_same_v<
+        decltype(tuple::alternating_split(std::tuple<
+                                            Iterators&...> {iterators...})
+                   .first),  // <- even indices in pack (begins)
+        decltype(tuple::alternating_split(std::tuple<
+                                            Iterators&...> {iterators...})
+                   .second)>,  // <- odd indices in pack (ends)
+      "Begin-end pairs must be the same type of iterator"
+    );
+
+    const auto [begins, ends] {
+      tuple::alternating_split(std::tuple<Iterators&...>(iterators...))
+    };
+    impl::for_each_chain_parallel_impl(
+      policy, func, begins, ends,
+      std::make_index_sequence<sizeof...(Iterators) / 2> {}
+    );
+}
+
 /* {{{ doc */
 /**
  * @brief Determine if all arguments satisfy a predicate
@@ -748,11 +2074,128 @@ constexpr void generate(Itr begin, const Itr end, Gen&& gen)
     }
 }
 
+/* {{{ doc */
+/**
+ * @brief `generate`, with the loop unrolled by `Unroll`.
+ *
+ * @details If `Itr` is contiguous or a random access `supl::iterator`,
+ * `Unroll` elements are generated per loop iteration,
+ * and any remainder one at a time.
+ * `gen` is still called once per element, in order.
+ * Otherwise, equivalent to `generate`.
+ *
+ * Usage: `supl::generate<4>(begin, end, gen)`
+ *
+ * @tparam Unroll Number of elements per loop iteration.
+ * Must not be zero.
+ */
+/* }}} */
+template <std::size_t Unroll, typename Itr, typename Gen>
+constexpr void generate(Itr begin, const Itr end, Gen&& gen)
+  noexcept(noexcept(gen()) && noexcept(*begin))
+{
+    if constexpr ( impl::is_indexable_v<Itr> )
+    {
+        impl::unrolled_for<Unroll>(
+          static_cast<std::size_t>(std::distance(begin, end)),
+          [begin, &gen](const std::size_t i)
+          {
+              begin[static_cast<std::ptrdiff_t>(i)] = gen();
+          }
+        );
+    }
+    else
+    {
+        ::supl::generate(begin, end, std::forward<Gen>(gen));
+    }
+}
+
+/* {{{ doc */
+/**
+ * @brief Parallel version of `generate`,
+ * where each element is generated from its index.
+ *
+ * @details `gen` is called as `gen(i)` for each index `i` in
+ * `[0, end - begin)`, and its result assigned to `begin[i]`.
+ * As each result depends only on its index, the output is identical
+ * however many threads are used.
+ *
+ * For random data, `gen` may construct a `supl::counter_rng`
+ * from a fixed seed and `i`.
+ *
+ * `gen` may be called concurrently, and in no particular order.
+ *
+ * @tparam Itr Random access iterator type.
+ *
+ * @tparam Gen Function which accepts a `std::size_t`,
+ * and returns a value assignable to `*begin`.
+ *
+ * @param policy Execution policy, such as `supl::par`.
+ *
+ * @param begin Beginning of range to be generated over.
+ *
+ * @param end End of range to be generated over.
+ *
+ * @param gen Function from index to value.
+ */
+/* }}} */
+template <typename Itr, typename Gen>
+void generate(
+  const parallel_policy policy, const Itr begin, const Itr end, Gen&& gen
+)
+{
+    static_assert(
+      supl::is_random_access_v<Itr>,
+      "Parallel generate requires random access iterators"
+    );
+
+    constexpr std::size_t granularity {impl::parallel_cache_line_granularity<
+      typename std::iterator_traits<Itr>::value_type>};
+
+    const auto size {static_cast<std::size_t>(std::distance(begin, end))};
+
+    impl::parallel_chunks(
+      size, impl::parallel_chunk_count(policy, size, granularity),
+      [begin, &gen](
+        const std::size_t, const std::size_t first, const std::size_t last
+      )
+      {
+          for ( std::size_t i {first}; i != last; ++i )
+          {
+              begin[static_cast<std::ptrdiff_t>(i)] = gen(i);
+          }
+      },
+      granularity
+    );
+}
+
+/* {{{ doc */
+/**
+ * @brief constexpr re-implementation of `std::transform`
+ *
+ * @details If `Itr` is a `supl::iterator` erasing a contiguous iterator,
+ * the input range is traversed through pointers,
+ * bypassing a virtual call per element.
+ */
+/* }}} */
 template <typename Itr, typename OutItr, typename TransformFunc>
 constexpr void transform(
   Itr begin, const Itr end, OutItr output_itr, TransformFunc&& func
 ) noexcept(noexcept(func(*begin)))
 {
+    if constexpr ( is_erased_iterator_v<Itr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            ::supl::transform(
+              span->first, span->second, std::move(output_itr),
+              std::forward<TransformFunc>(func)
+            );
+            return;
+        }
+    }
+
     for ( ; begin != end; ++begin )
     {
         *output_itr = func(*begin);
@@ -760,11 +2203,135 @@ constexpr void transform(
     }
 }
 
+/* {{{ doc */
+/**
+ * @brief `transform`, with the loop unrolled by `Unroll`.
+ *
+ * @details If both `Itr` and `OutItr` are contiguous
+ * or random access `supl::iterator`s,
+ * `Unroll` elements are transformed per loop iteration,
+ * and any remainder one at a time.
+ * Elements are transformed in order.
+ * Otherwise, equivalent to `transform`.
+ *
+ * Usage: `supl::transform<4>(begin, end, output_itr, func)`
+ *
+ * @tparam Unroll Number of elements per loop iteration.
+ * Must not be zero.
+ */
+/* }}} */
+template <
+  std::size_t Unroll, typename Itr, typename OutItr, typename TransformFunc>
+constexpr void transform(
+  Itr begin, const Itr end, OutItr output_itr, TransformFunc&& func
+) noexcept(noexcept(func(*begin)))
+{
+    if constexpr ( is_erased_iterator_v<Itr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            ::supl::transform<Unroll>(
+              span->first, span->second, output_itr,
+              std::forward<TransformFunc>(func)
+            );
+            return;
+        }
+    }
+
+    if constexpr ( impl::is_indexable_v<Itr>
+                   && impl::is_indexable_v<OutItr> )
+    {
+        impl::unrolled_for<Unroll>(
+          static_cast<std::size_t>(std::distance(begin, end)),
+          [begin, output_itr, &func](const std::size_t i)
+          {
+              output_itr[static_cast<std::ptrdiff_t>(i)] =
+                func(begin[static_cast<std::ptrdiff_t>(i)]);
+          }
+        );
+    }
+    else
+    {
+        ::supl::transform(
+          begin, end, output_itr, std::forward<TransformFunc>(func)
+        );
+    }
+}
+
+namespace impl
+{
+    // Copies between these iterators may be done with `std::memmove`
+    template <typename InItr, typename OutItr, typename = void>
+    constexpr inline bool is_memmove_copyable_v {false};
+
+    template <typename InItr, typename OutItr>
+    constexpr inline bool is_memmove_copyable_v<
+      InItr, OutItr,
+      std::void_t<
+        typename std::iterator_traits<InItr>::value_type,
+        typename std::iterator_traits<OutItr>::value_type>> {
+      is_contiguous_iterator_v<InItr> && is_contiguous_iterator_v<OutItr>
+      && std::is_same_v<
+        typename std::iterator_traits<InItr>::value_type,
+        typename std::iterator_traits<OutItr>::value_type>
+      && std::is_trivially_copyable_v<
+        typename std::iterator_traits<InItr>::value_type>
+      && std::is_assignable_v<
+        typename std::iterator_traits<OutItr>::reference,
+        typename std::iterator_traits<InItr>::reference>};
+
+    template <typename InItr, typename OutItr>
+    auto memmove_copy(const InItr begin, const std::size_t n, const OutItr out)
+      noexcept -> OutItr
+    {
+        if ( n != 0 )
+        {
+            std::memmove(
+              std::addressof(*out), std::addressof(*begin),
+              n * sizeof(typename std::iterator_traits<InItr>::value_type)
+            );
+        }
+
+        return std::next(out, static_cast<std::ptrdiff_t>(n));
+    }
+}  // namespace impl
+
+/* {{{ doc */
+/**
+ * @brief constexpr re-implementation of `std::copy`
+ *
+ * @details If `InItr` is a `supl::iterator` erasing a contiguous iterator,
+ * the input range is traversed through pointers,
+ * bypassing a virtual call per element.
+ *
+ * If both ranges are contiguous, and of the same trivially copyable type,
+ * the copy is done with `std::memmove` outside of constant evaluation.
+ */
+/* }}} */
 template <typename InItr, typename OutItr>
 constexpr auto copy(InItr begin, const InItr end, OutItr out)
   noexcept(std::is_nothrow_copy_constructible_v<
            typename std::iterator_traits<InItr>::value_type>) -> OutItr
 {
+    if constexpr ( is_erased_iterator_v<InItr> )
+    {
+        if ( const auto span {begin.contiguous_span(end)};
+             span.has_value() )
+        {
+            return ::supl::copy(span->first, span->second, std::move(out));
+        }
+    }
+    else if constexpr ( impl::is_memmove_copyable_v<InItr, OutItr> )
+    {
+        if ( ! impl::is_constant_evaluated() )
+        {
+            return impl::memmove_copy(
+              begin, static_cast<std::size_t>(std::distance(begin, end)), out
+            );
+        }
+    }
+
     for ( ; begin != end; ++out, ++begin )
     {
         *out = *begin;
@@ -773,14 +2340,41 @@ constexpr auto copy(InItr begin, const InItr end, OutItr out)
     return out;
 }
 
+/* {{{ doc */
+/**
+ * @brief constexpr re-implementation of `std::copy_n`
+ *
+ * @details If both ranges are contiguous,
+ * and of the same trivially copyable type,
+ * the copy is done with `std::memmove` outside of constant evaluation.
+ */
+/* }}} */
 template <typename InItr, typename OutItr>
 constexpr auto copy_n(InItr begin, const std::size_t n, OutItr out)
   noexcept(std::is_nothrow_copy_constructible_v<
            typename std::iterator_traits<InItr>::value_type>) -> OutItr
 {
-    for ( std::size_t i {0}; i != n; ++i, ++out, ++begin )
+    if constexpr ( impl::is_memmove_copyable_v<InItr, OutItr> )
     {
-        *out = *begin;
+        if ( ! impl::is_constant_evaluated() )
+        {
+            return impl::memmove_copy(begin, n, out);
+        }
+    }
+
+    if constexpr ( impl::is_indexable_v<InItr> )
+    {
+        for ( std::size_t i {0}; i != n; ++i, ++out )
+        {
+            *out = begin[static_cast<std::ptrdiff_t>(i)];
+        }
+    }
+    else
+    {
+        for ( std::size_t i {0}; i != n; ++i, ++out, ++begin )
+        {
+            *out = *begin;
+        }
     }
 
     return out;
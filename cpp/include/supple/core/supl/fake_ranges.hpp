@@ -24,14 +24,71 @@
 // have a `fr` counterpart
 
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "internal/algorithm/parallel.hpp"
+#include "internal/algorithm/simd_count.hpp"
+#include "iterators.hpp"
+#include "metaprogramming.hpp"
+#include "predicates.hpp"
+#include "type_list.hpp"
+
 namespace supl::fr
 {
 
+template <std::size_t N>
+class iota_nd;
+
+/* {{{ doc */
+/**
+ * @brief Determines if `T` is a specialization of `supl::fr::iota_nd`
+ */
+/* }}} */
+template <typename T>
+struct is_iota_nd : std::false_type
+{
+};
+
+template <std::size_t N>
+struct is_iota_nd<iota_nd<N>> : std::true_type
+{
+};
+
+template <typename T>
+constexpr inline bool is_iota_nd_v = is_iota_nd<T>::value;
+
+/* {{{ doc */
+/**
+ * @brief Base class of the lazy views in `supl::fr`,
+ * such as those returned by `fr::filter` and `fr::transform`.
+ */
+/* }}} */
+struct view_base
+{
+};
+
+/* {{{ doc */
+/**
+ * @brief Determines if `T` is a lazy view from `supl::fr`
+ */
+/* }}} */
+template <typename T>
+struct is_view : std::is_base_of<view_base, T>
+{
+};
+
+template <typename T>
+constexpr inline bool is_view_v = is_view<T>::value;
+
 template <typename Container, typename Pred>
 auto all_of(Container&& container, Pred&& pred)
   noexcept(noexcept(std::all_of(
@@ -71,8 +128,94 @@ auto for_each(Container&& container, Func&& func)
     std::begin(container), std::end(container), std::forward<Func>(func)
   ))) -> Func
 {
-    return std::for_each(
-      std::begin(container), std::end(container), std::forward<Func>(func)
+    // `supl::any_range` runs the loop in a single virtual call
+    if constexpr ( is_any_range_v<remove_cvref_t<Container>> )
+    {
+        return container.for_each(std::forward<Func>(func));
+    }
+    else if constexpr ( is_iota_nd_v<remove_cvref_t<Container>> )
+    {
+        // `iota_nd` visits whole tiles with nested loops
+        return container.for_each(std::forward<Func>(func));
+    }
+    else if constexpr ( is_view_v<remove_cvref_t<Container>> )
+    {
+        // views fuse their stages into the loop of the underlying range
+        return container.for_each(std::forward<Func>(func));
+    }
+    else
+    {
+        // `std::for_each` returns a copy, which must not be returned
+        // through `Func` if it is a reference
+        std::for_each(
+          std::begin(container), std::end(container), std::ref(func)
+        );
+        return std::forward<Func>(func);
+    }
+}
+
+/* {{{ doc */
+/**
+ * @brief Calls `func` on each element of `container`,
+ * splitting the elements across several threads.
+ *
+ * @details Each thread visits a contiguous part of the container in order.
+ * `func` may be called concurrently.
+ *
+ * @tparam Container Type with random access iterators.
+ */
+/* }}} */
+template <typename Container, typename Func>
+void for_each(
+  const parallel_policy policy, Container&& container, Func&& func
+)
+{
+    const auto begin {std::begin(container)};
+
+    static_assert(
+      is_random_access_v<decltype(begin)>,
+      "Parallel for_each requires random access iterators"
+    );
+
+    const auto size {
+      static_cast<std::size_t>(std::distance(begin, std::end(container)))};
+
+    if constexpr ( is_iota_nd_v<remove_cvref_t<Container>> )
+    {
+        // chunks split the same way as the traversal,
+        // so each is visited with nested loops
+        const std::size_t chunk_count {
+          ::supl::impl::parallel_chunk_count(policy, size)};
+
+        ::supl::impl::parallel_chunks(
+          size, chunk_count,
+          [&container, chunk_count, &func](
+            const std::size_t chunk, const std::size_t /*unused*/,
+            const std::size_t /*unused*/
+          )
+          {
+              container.chunk(chunk_count, chunk).for_each(func);
+          }
+        );
+
+        return;
+    }
+
+    ::supl::impl::parallel_chunks(
+      size, ::supl::impl::parallel_chunk_count(policy, size),
+      [begin, &func](
+        const std::size_t /*unused*/, const std::size_t first,
+        const std::size_t last
+      )
+      {
+          const auto chunk_end {
+            std::next(begin, static_cast<std::ptrdiff_t>(last))};
+          for ( auto itr {std::next(begin, static_cast<std::ptrdiff_t>(first))};
+                itr != chunk_end; ++itr )
+          {
+              func(*itr);
+          }
+      }
     );
 }
 
@@ -88,24 +231,240 @@ auto for_each_n(Container&& container, Size n, Func&& func)
     );
 }
 
+namespace impl
+{
+    // Whether comparing an element of type `T` against an operand of
+    // type `U` can be done by converting the operand to `T`
+    // and comparing lane-wise, without changing the result
+    template <typename T, typename U, typename = void>
+    struct is_simd_countable : std::false_type
+    {
+    };
+
+    template <typename T, typename U>
+    struct is_simd_countable<
+      T, U, std::enable_if_t<std::is_arithmetic_v<U>>>
+            : std::bool_constant<
+                ::supl::impl::is_simd_searchable_v<T>
+                && std::is_same_v<std::common_type_t<T, U>, T>>
+    {
+    };
+
+    template <typename T, typename U>
+    constexpr inline bool is_simd_countable_v =
+      is_simd_countable<T, U>::value;
+
+    // Maps the predicates from `predicates.hpp` which have a vectorized
+    // counting kernel to the comparison they make, and their operand type
+    template <typename Pred>
+    struct simd_count_predicate
+    {
+        constexpr static bool recognized {false};
+    };
+
+    template <typename U>
+    struct simd_count_predicate<predicate<::supl::impl::equal_to_pred<U>>>
+    {
+        constexpr static bool recognized {true};
+        constexpr static auto comparison {
+          ::supl::impl::simd_comparison::equal};
+        using operand_type = U;
+    };
+
+    template <typename U>
+    struct simd_count_predicate<predicate<::supl::impl::less_than_pred<U>>>
+    {
+        constexpr static bool recognized {true};
+        constexpr static auto comparison {
+          ::supl::impl::simd_comparison::less};
+        using operand_type = U;
+    };
+
+    template <typename U>
+    struct simd_count_predicate<
+      predicate<::supl::impl::greater_than_pred<U>>>
+    {
+        constexpr static bool recognized {true};
+        constexpr static auto comparison {
+          ::supl::impl::simd_comparison::greater};
+        using operand_type = U;
+    };
+
+    template <typename U>
+    struct simd_count_predicate<predicate<::supl::impl::between_pred<U>>>
+    {
+        constexpr static bool recognized {true};
+        constexpr static auto comparison {
+          ::supl::impl::simd_comparison::between};
+        using operand_type = U;
+    };
+
+    // Whether `count_if(container, pred)` can use a vectorized kernel
+    template <typename Itr, typename Pred, typename = void>
+    struct is_simd_count_if : std::false_type
+    {
+    };
+
+    template <typename Itr, typename Pred>
+    struct is_simd_count_if<
+      Itr, Pred,
+      std::enable_if_t<simd_count_predicate<Pred>::recognized>>
+            : std::bool_constant<
+                is_contiguous_iterator_v<Itr>
+                && is_simd_countable_v<
+                  typename std::iterator_traits<Itr>::value_type,
+                  typename simd_count_predicate<Pred>::operand_type>>
+    {
+    };
+
+    // Count the elements of the contiguous range [begin, end)
+    // which satisfy `Comparison` against `first`,
+    // and `second` if it is `between`
+    template <
+      ::supl::impl::simd_comparison Comparison, typename Itr,
+      typename U>
+    [[nodiscard]] auto simd_count_contiguous(
+      const Itr begin, const Itr end, const U& first, const U& second
+    ) noexcept -> typename std::iterator_traits<Itr>::difference_type
+    {
+        using value_type = typename std::iterator_traits<Itr>::value_type;
+
+        if ( begin == end )
+        {
+            return 0;
+        }
+
+        const value_type* const data {std::addressof(*begin)};
+        return static_cast<
+          typename std::iterator_traits<Itr>::difference_type>(
+          ::supl::impl::simd_count<Comparison>(
+            data, data + std::distance(begin, end),
+            static_cast<value_type>(first), static_cast<value_type>(second)
+          )
+        );
+    }
+}  // namespace impl
+
+/* {{{ doc */
+/**
+ * @brief Counts the elements of `container` equal to `value`.
+ *
+ * @details If `container` is contiguous and its elements are arithmetic,
+ * and `value` converts to the element type without changing
+ * the result of any comparison, a vector register's worth of elements
+ * is compared at a time.
+ */
+/* }}} */
 template <typename Container, typename T>
 auto count(Container&& container, const T& value) noexcept(
   noexcept(std::count(std::begin(container), std::end(container), value))
 ) -> typename std::iterator_traits<decltype(std::begin(container)
 )>::difference_type
 {
-    return std::count(std::begin(container), std::end(container), value);
+    if constexpr ( is_any_range_v<remove_cvref_t<Container>> )
+    {
+        typename std::iterator_traits<decltype(std::begin(container)
+        )>::difference_type count {0};
+
+        container.for_each(
+          [&count, &value](const auto& element)
+          {
+              if ( std::equal_to<> {}(element, value) )
+              {
+                  ++count;
+              }
+          }
+        );
+
+        return count;
+    }
+    else
+    {
+        using iterator = decltype(std::begin(container));
+
+        if constexpr ( is_contiguous_iterator_v<iterator>
+                       && impl::is_simd_countable_v<
+                         typename std::iterator_traits<iterator>::value_type,
+                         T> )
+        {
+            return impl::simd_count_contiguous<
+              ::supl::impl::simd_comparison::equal>(
+              std::begin(container), std::end(container), value, value
+            );
+        }
+        else
+        {
+            return std::count(
+              std::begin(container), std::end(container), value
+            );
+        }
+    }
 }
 
+/* {{{ doc */
+/**
+ * @brief Counts the elements of `container` satisfying `pred`.
+ *
+ * @details If `container` is contiguous and its elements are arithmetic,
+ * and `pred` was made by `supl::equal_to`, `supl::less_than`,
+ * `supl::greater_than` or `supl::between` with operands which convert
+ * to the element type without changing the result of any comparison,
+ * a vector register's worth of elements is compared at a time.
+ */
+/* }}} */
 template <typename Container, typename Pred>
 auto count_if(Container&& container, Pred&& pred) noexcept(
-  noexcept(std::count(std::begin(container), std::end(container), pred))
+  noexcept(std::count_if(std::begin(container), std::end(container), pred))
 ) -> typename std::iterator_traits<decltype(std::begin(container)
 )>::difference_type
 {
-    return std::count_if(
-      std::begin(container), std::end(container), std::forward<Pred>(pred)
-    );
+    if constexpr ( is_any_range_v<remove_cvref_t<Container>> )
+    {
+        typename std::iterator_traits<decltype(std::begin(container)
+        )>::difference_type count {0};
+
+        container.for_each(
+          [&count, &pred](const auto& element)
+          {
+              if ( pred(element) )
+              {
+                  ++count;
+              }
+          }
+        );
+
+        return count;
+    }
+    else if constexpr ( impl::is_simd_count_if<
+                          decltype(std::begin(container)),
+                          remove_cvref_t<Pred>>::value )
+    {
+        using traits = impl::simd_count_predicate<remove_cvref_t<Pred>>;
+        const auto& base {pred.base()};
+
+        if constexpr ( traits::comparison
+                       == ::supl::impl::simd_comparison::between )
+        {
+            return impl::simd_count_contiguous<traits::comparison>(
+              std::begin(container), std::end(container), base.lower_bound,
+              base.upper_bound
+            );
+        }
+        else
+        {
+            return impl::simd_count_contiguous<traits::comparison>(
+              std::begin(container), std::end(container), base.arg,
+              base.arg
+            );
+        }
+    }
+    else
+    {
+        return std::count_if(
+          std::begin(container), std::end(container),
+          std::forward<Pred>(pred)
+        );
+    }
 }
 
 /* {{{ doc */
@@ -117,12 +476,20 @@ auto count_if(Container&& container, Pred&& pred) noexcept(
  * Usable at compile-time.
  * Iterators can be created directly.
  *
+ * @details If `T` is arithmetic, iterators are random access,
+ * `size` is constant time, and a step other than one may be given.
+ * The value at index `i` is computed as `begin + i * step`
+ * rather than by repeated addition,
+ * so floating point sequences do not accumulate error.
+ * Otherwise iterators are bidirectional,
+ * and values are produced by pre-increment.
+ *
  * @tparam T Type of the sequence.
  * Must support pre-increment and equality comparison.
  * It is strongly advised that `T` be cheap to copy.
  *
- * @pre `begin_value` must be greater than `end_value`.
- * If `T` is an unsigned integral type, behavior will be undefined.
+ * @pre If `T` is not arithmetic, `begin_value` must not be greater than
+ * `end_value`.
  */
 /* }}} */
 template <typename T>
@@ -130,8 +497,126 @@ class iota
 {
 private:
 
-    T m_begin_value;
-    T m_end_value;
+    constexpr static bool is_random_access {
+      std::is_arithmetic_v<T> && ! std::is_same_v<T, bool>};
+
+    // `to - from` for integral `T`, where `from <= to`.
+    // Computed in unsigned arithmetic, as it may not fit in `T`.
+    [[nodiscard]] constexpr static auto
+    p_unsigned_distance(const T from, const T to) noexcept -> std::uintmax_t
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        return static_cast<unsigned_type>(
+          static_cast<unsigned_type>(to) - static_cast<unsigned_type>(from)
+        );
+    }
+
+    // Value `index` steps from `origin`.
+    // `index` wraps below zero, as iterators may be moved backwards.
+    [[nodiscard]] constexpr static auto p_value_at(
+      const T origin, const T step, const std::size_t index
+    ) noexcept -> T
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            return origin
+                 + static_cast<T>(static_cast<std::ptrdiff_t>(index)) * step;
+        }
+        else
+        {
+            // unsigned arithmetic wraps where `T` could overflow,
+            // and arrives at the same value if it is in range of `T`
+            return static_cast<T>(
+              static_cast<std::uintmax_t>(origin)
+              + static_cast<std::uintmax_t>(index)
+                  * static_cast<std::uintmax_t>(step)
+            );
+        }
+    }
+
+    // Number of values `begin + i * step` before `end`,
+    // in the direction of `step`
+    [[nodiscard]] constexpr static auto
+    p_step_count(const T begin, const T end, const T step) noexcept
+      -> std::size_t
+    {
+        const bool ascending {T {0} < step};
+        const bool descending {step < T {0}};
+
+        if ( ascending ? ! (begin < end)
+                       : ! descending || ! (end < begin) )
+        {
+            return 0;
+        }
+
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            const auto before_end {[begin, end, step,
+                                    ascending](const std::size_t index)
+                                   {
+                                       const T value {
+                                         p_value_at(begin, step, index)};
+                                       return ascending ? value < end
+                                                        : end < value;
+                                   }};
+
+            // the quotient may be rounded either way,
+            // so check it against the values iterators will produce
+            auto count {static_cast<std::size_t>((end - begin) / step)};
+            while ( count > 0 && ! before_end(count - 1) )
+            {
+                --count;
+            }
+            while ( before_end(count) )
+            {
+                ++count;
+            }
+
+            return count;
+        }
+        else
+        {
+            const std::uintmax_t distance {
+              ascending ? p_unsigned_distance(begin, end)
+                        : p_unsigned_distance(end, begin)};
+            const std::uintmax_t stride {
+              ascending ? p_unsigned_distance(T {0}, step)
+                        : p_unsigned_distance(step, T {0})};
+
+            return static_cast<std::size_t>(
+              distance / stride + (distance % stride == 0 ? 0 : 1)
+            );
+        }
+    }
+
+    // Number of steps from `from` to `to`, wrapping below zero
+    [[nodiscard]] constexpr static auto
+    p_steps_between(const T from, const T to, const T step) noexcept
+      -> std::size_t
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            const T steps {(to - from) / step};
+            return static_cast<std::size_t>(static_cast<std::ptrdiff_t>(
+              steps < T {0} ? steps - T {0.5} : steps + T {0.5}
+            ));
+        }
+        else
+        {
+            const bool ascending {T {0} < step};
+            const bool backwards {to < from};
+
+            const std::uintmax_t distance {
+              backwards ? p_unsigned_distance(to, from)
+                        : p_unsigned_distance(from, to)};
+            const std::uintmax_t stride {
+              ascending ? p_unsigned_distance(T {0}, step)
+                        : p_unsigned_distance(step, T {0})};
+            const auto steps {static_cast<std::size_t>(distance / stride)};
+
+            return backwards == ascending ? std::size_t {0} - steps : steps;
+        }
+    }
 
     /* {{{ iterator_base */
     template <bool is_const>
@@ -139,10 +624,10 @@ private:
     {
 
         /* using value_type        = std::conditional_t<is_const, const T, T>; */
-        using value_type      = T;
-        using difference_type = std::ptrdiff_t;
-        using pointer         = std::conditional_t<is_const, const T*, T*>;
-        using reference       = std::conditional_t<is_const, const T&, T&>;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<is_const, const T*, T*>;
+        using reference         = std::conditional_t<is_const, const T&, T&>;
         using iterator_category = std::bidirectional_iterator_tag;
 
         value_type value;
@@ -202,49 +687,1578 @@ private:
 
     /* }}} */
 
-public:
-
-    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-    constexpr explicit iota(const T& begin_value, const T& end_value)
-            : m_begin_value {begin_value}
-            , m_end_value {end_value}
+    /* {{{ indexed_iterator_base */
+    // Iterator for arithmetic `T`.
+    // Holds its position as an index from `origin`,
+    // and the value at that index.
+    // Past the end, the value is that the sequence was constructed with,
+    // as the next value in the sequence may not be representable.
+    // Creating one directly from a value starts a unit step sequence there.
+    template <bool is_const>
+    struct indexed_iterator_base
     {
-    }
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<is_const, const T*, T*>;
+        using reference         = std::conditional_t<is_const, const T&, T&>;
+        using iterator_category = std::random_access_iterator_tag;
 
-    using iterator       = iterator_base<false>;
-    using const_iterator = iterator_base<true>;
+        value_type value;
+        value_type origin {value};
+        value_type step {1};
+        std::size_t index {0};
 
-    [[nodiscard]] constexpr auto begin() -> iterator
-    {
-        return iterator {m_begin_value};
-    }
+        [[nodiscard]] constexpr auto
+        p_same_sequence(const indexed_iterator_base& rhs) const noexcept
+          -> bool
+        {
+            // `std::equal_to` as `T` may be floating point
+            return std::equal_to<> {}(origin, rhs.origin)
+                && std::equal_to<> {}(step, rhs.step);
+        }
 
-    [[nodiscard]] constexpr auto begin() const -> const_iterator
-    {
-        return const_iterator {m_begin_value};
-    }
+        constexpr auto operator++() noexcept -> indexed_iterator_base&
+        {
+            return *this += 1;
+        }
 
-    [[nodiscard]] constexpr auto cbegin() const -> const_iterator
-    {
-        return const_iterator {m_begin_value};
-    }
+        [[nodiscard]] constexpr auto operator++(int) noexcept
+          -> indexed_iterator_base
+        {
+            indexed_iterator_base copy {*this};
+            this->operator++();
+            return copy;
+        }
 
-    [[nodiscard]] constexpr auto end() -> iterator
-    {
-        return iterator {m_end_value};
-    }
+        constexpr auto operator--() noexcept -> indexed_iterator_base&
+        {
+            return *this -= 1;
+        }
 
-    [[nodiscard]] constexpr auto end() const -> const_iterator
-    {
-        return const_iterator {m_end_value};
-    }
+        [[nodiscard]] constexpr auto operator--(int) noexcept
+          -> indexed_iterator_base
+        {
+            indexed_iterator_base copy {*this};
+            this->operator--();
+            return copy;
+        }
 
-    [[nodiscard]] constexpr auto cend() const -> const_iterator
-    {
-        return const_iterator {m_end_value};
-    }
-};
+        [[nodiscard]] constexpr auto operator*() noexcept -> reference
+        {
+            return value;
+        }
 
-}  // namespace supl::fr
+        [[nodiscard]] constexpr auto operator->() noexcept -> pointer
+        {
+            return &value;
+        }
+
+        // Iterators of one sequence are compared by position.
+        // Those created directly from values may not share an origin,
+        // so are compared by value.
+        [[nodiscard]] friend constexpr auto operator==(
+          const indexed_iterator_base& lhs, const indexed_iterator_base& rhs
+        ) noexcept -> bool
+        {
+            if ( lhs.p_same_sequence(rhs) )
+            {
+                return lhs.index == rhs.index;
+            }
+
+            // `std::equal_to` as `T` may be floating point
+            return std::equal_to<> {}(lhs.value, rhs.value);
+        }
+
+        [[nodiscard]] friend constexpr auto operator!=(
+          const indexed_iterator_base& lhs, const indexed_iterator_base& rhs
+        ) noexcept -> bool
+        {
+            return ! (lhs == rhs);
+        }
+
+        constexpr auto operator+=(const difference_type n) noexcept
+          -> indexed_iterator_base&
+        {
+            index += static_cast<std::size_t>(n);
+            value = p_value_at(origin, step, index);
+            return *this;
+        }
+
+        constexpr auto operator-=(const difference_type n) noexcept
+          -> indexed_iterator_base&
+        {
+            return *this += -n;
+        }
+
+        [[nodiscard]] constexpr auto operator+(const difference_type n
+        ) const noexcept -> indexed_iterator_base
+        {
+            indexed_iterator_base copy {*this};
+            copy += n;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr auto operator+(
+          const difference_type n, const indexed_iterator_base& itr
+        ) noexcept -> indexed_iterator_base
+        {
+            return itr + n;
+        }
+
+        [[nodiscard]] constexpr auto operator-(const difference_type n
+        ) const noexcept -> indexed_iterator_base
+        {
+            indexed_iterator_base copy {*this};
+            copy -= n;
+            return copy;
+        }
+
+        // Iterators of one sequence share an origin,
+        // but those created directly from values may not
+        [[nodiscard]] constexpr auto operator-(
+          const indexed_iterator_base& rhs
+        ) const noexcept -> difference_type
+        {
+            return static_cast<difference_type>(
+              index - rhs.index + p_steps_between(rhs.origin, origin, step)
+            );
+        }
+
+        // There is no element at `n` to refer to,
+        // so unlike `*(itr + n)` this does not yield `reference`.
+        // `supl` algorithms index iterators only where it does.
+        [[nodiscard]] constexpr auto operator[](const difference_type n
+        ) const noexcept -> value_type
+        {
+            return p_value_at(
+              origin, step, index + static_cast<std::size_t>(n)
+            );
+        }
+
+        [[nodiscard]] constexpr auto operator<(
+          const indexed_iterator_base& rhs
+        ) const noexcept -> bool
+        {
+            // the distance between positions of a sequence
+            // may not fit in `difference_type`
+            if ( p_same_sequence(rhs) )
+            {
+                return index < rhs.index;
+            }
+
+            return *this - rhs < 0;
+        }
+
+        [[nodiscard]] constexpr auto operator>(
+          const indexed_iterator_base& rhs
+        ) const noexcept -> bool
+        {
+            return rhs < *this;
+        }
+
+        [[nodiscard]] constexpr auto operator<=(
+          const indexed_iterator_base& rhs
+        ) const noexcept -> bool
+        {
+            return ! (rhs < *this);
+        }
+
+        [[nodiscard]] constexpr auto operator>=(
+          const indexed_iterator_base& rhs
+        ) const noexcept -> bool
+        {
+            return ! (*this < rhs);
+        }
+    };
+
+    /* }}} */
+
+public:
+
+    using iterator = std::conditional_t<
+      is_random_access, indexed_iterator_base<false>, iterator_base<false>>;
+    using const_iterator = std::conditional_t<
+      is_random_access, indexed_iterator_base<true>, iterator_base<true>>;
+
+private:
+
+    iterator m_begin;
+    iterator m_end;
+
+    [[nodiscard]] constexpr static auto p_as_const(const iterator& itr)
+      -> const_iterator
+    {
+        if constexpr ( is_random_access )
+        {
+            return const_iterator {itr.value, itr.origin, itr.step, itr.index};
+        }
+        else
+        {
+            return const_iterator {itr.value};
+        }
+    }
+
+    [[nodiscard]] constexpr static auto
+    p_make_end(const T& begin_value, const T& end_value, const T& step)
+      -> iterator
+    {
+        return iterator {
+          end_value, begin_value, step,
+          p_step_count(begin_value, end_value, step)};
+    }
+
+    [[nodiscard]] constexpr static auto
+    p_make_end(const T& begin_value, const T& end_value) -> iterator
+    {
+        if constexpr ( is_random_access )
+        {
+            return p_make_end(begin_value, end_value, T {1});
+        }
+        else
+        {
+            return iterator {end_value};
+        }
+    }
+
+public:
+
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    constexpr explicit iota(const T& begin_value, const T& end_value)
+            : m_begin {begin_value}
+            , m_end {p_make_end(begin_value, end_value)}
+    {
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Sequence `begin_value + i * step` for each `i`
+   * for which the value lies in [begin_value, end_value),
+   * or in (end_value, begin_value] if `step` is negative.
+   * Only available if `T` is arithmetic.
+   *
+   * @pre `step` must not be zero. This is checked by an assertion.
+   */
+    /* }}} */
+    template <
+      bool Random_Access = is_random_access,
+      typename           = std::enable_if_t<Random_Access>>
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    constexpr explicit iota(
+      const T& begin_value, const T& end_value, const T& step
+    )
+            : m_begin {begin_value, begin_value, step, 0}
+            , m_end {p_make_end(begin_value, end_value, step)}
+    {
+        assert((step < T {0} || T {0} < step) && "step must not be zero");
+    }
+
+    [[nodiscard]] constexpr auto begin() -> iterator
+    {
+        return m_begin;
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> const_iterator
+    {
+        return p_as_const(m_begin);
+    }
+
+    [[nodiscard]] constexpr auto cbegin() const -> const_iterator
+    {
+        return p_as_const(m_begin);
+    }
+
+    [[nodiscard]] constexpr auto end() -> iterator
+    {
+        return m_end;
+    }
+
+    [[nodiscard]] constexpr auto end() const -> const_iterator
+    {
+        return p_as_const(m_end);
+    }
+
+    [[nodiscard]] constexpr auto cend() const -> const_iterator
+    {
+        return p_as_const(m_end);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Number of values in the sequence, in constant time.
+   * Only available if `T` is arithmetic.
+   */
+    /* }}} */
+    template <
+      bool Random_Access = is_random_access,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+    {
+        return m_end.index - m_begin.index;
+    }
+};
+
+/* {{{ doc */
+/**
+ * @brief Container-like class which wraps the index space
+ * of an `N` dimensional grid, so nested loops may be one flat loop.
+ *
+ * @details Each value is a `std::tuple` of `N` `std::size_t` indices,
+ * the first of which is the outermost.
+ * By default the grid is visited in row-major order.
+ * If a tile shape is given, the grid is visited one tile at a time.
+ * Tiles are taken in row-major order, and each tile is visited
+ * in row-major order, so neighboring indices are visited close together.
+ * Tiles at the far edge of a dimension are clipped to the grid.
+ *
+ * Iterators are random access, and the index at any position
+ * is computed directly, so any part of the traversal
+ * may be visited independently of the rest.
+ * `chunk` splits the traversal into balanced parts
+ * for parallel execution.
+ * Safe to use as a prvalue.
+ * Usable at compile-time.
+ *
+ * @tparam N Number of dimensions.
+ */
+/* }}} */
+template <std::size_t N>
+class iota_nd
+{
+    static_assert(N != 0, "iota_nd requires at least one dimension");
+
+public:
+
+    using extents_type = std::array<std::size_t, N>;
+    using index_type   = tl::repeat_t<std::size_t, N, std::tuple>;
+
+private:
+
+    extents_type m_extents;
+    extents_type m_tile;
+    iota<std::size_t> m_positions;
+
+    [[nodiscard]] constexpr static auto
+    p_product(const extents_type& extents) noexcept -> std::size_t
+    {
+        std::size_t product {1};
+        for ( const std::size_t extent : extents )
+        {
+            product *= extent;
+        }
+        return product;
+    }
+
+    // A tile must have at least one index in each dimension,
+    // and need not be larger than the grid
+    [[nodiscard]] constexpr static auto
+    p_clamp_tile(const extents_type& extents, extents_type tile) noexcept
+      -> extents_type
+    {
+        for ( std::size_t dim {0}; dim != N; ++dim )
+        {
+            tile[dim] = std::clamp(
+              tile[dim], std::size_t {1},
+              std::max(extents[dim], std::size_t {1})
+            );
+        }
+        return tile;
+    }
+
+    /* {{{ const_iterator */
+    struct const_iterator
+    {
+        using value_type        = index_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = index_type;
+        using iterator_category = std::random_access_iterator_tag;
+
+        extents_type extents {};
+        extents_type tile {};
+        std::size_t size {0};
+        std::size_t position {0};
+
+        // Current index, and the bounds of the tile containing it
+        extents_type index {};
+        extents_type tile_begin {};
+        extents_type tile_end {};
+
+        constexpr const_iterator() = default;
+
+        constexpr const_iterator(
+          const extents_type& extents_, const extents_type& tile_,
+          const std::size_t position_
+        ) noexcept
+                : extents {extents_}
+                , tile {tile_}
+                , size {p_product(extents_)}
+                , position {position_}
+        {
+            this->p_locate();
+        }
+
+        [[nodiscard]] constexpr auto operator*() const noexcept
+          -> index_type
+        {
+            return p_to_tuple(index, std::make_index_sequence<N> {});
+        }
+
+        // Steps within the tile without dividing,
+        // and moves to the next tile once it is exhausted
+        constexpr auto operator++() noexcept -> const_iterator&
+        {
+            ++position;
+
+            for ( std::size_t dim {N}; dim != 0; --dim )
+            {
+                if ( index[dim - 1] + 1 < tile_end[dim - 1] )
+                {
+                    ++index[dim - 1];
+                    return *this;
+                }
+                index[dim - 1] = tile_begin[dim - 1];
+            }
+
+            this->p_next_tile();
+            return *this;
+        }
+
+        [[nodiscard]] constexpr auto operator++(int) noexcept
+          -> const_iterator
+        {
+            const_iterator copy {*this};
+            this->operator++();
+            return copy;
+        }
+
+        constexpr auto operator--() noexcept -> const_iterator&
+        {
+            return *this -= 1;
+        }
+
+        [[nodiscard]] constexpr auto operator--(int) noexcept
+          -> const_iterator
+        {
+            const_iterator copy {*this};
+            this->operator--();
+            return copy;
+        }
+
+        constexpr auto operator+=(const difference_type n) noexcept
+          -> const_iterator&
+        {
+            // unsigned arithmetic wraps back around for negative `n`
+            position += static_cast<std::size_t>(n);
+            this->p_locate();
+            return *this;
+        }
+
+        constexpr auto operator-=(const difference_type n) noexcept
+          -> const_iterator&
+        {
+            return *this += -n;
+        }
+
+        [[nodiscard]] constexpr auto operator+(const difference_type n
+        ) const noexcept -> const_iterator
+        {
+            const_iterator copy {*this};
+            copy += n;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator+(const difference_type n, const const_iterator& itr) noexcept
+          -> const_iterator
+        {
+            return itr + n;
+        }
+
+        [[nodiscard]] constexpr auto operator-(const difference_type n
+        ) const noexcept -> const_iterator
+        {
+            const_iterator copy {*this};
+            copy -= n;
+            return copy;
+        }
+
+        [[nodiscard]] constexpr auto operator-(const const_iterator& rhs
+        ) const noexcept -> difference_type
+        {
+            return static_cast<difference_type>(position)
+                 - static_cast<difference_type>(rhs.position);
+        }
+
+        [[nodiscard]] constexpr auto operator[](const difference_type n
+        ) const noexcept -> index_type
+        {
+            return *(*this + n);
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(
+          const const_iterator& lhs, const const_iterator& rhs
+        ) noexcept -> bool
+        {
+            return lhs.position == rhs.position;
+        }
+
+        [[nodiscard]] friend constexpr auto operator!=(
+          const const_iterator& lhs, const const_iterator& rhs
+        ) noexcept -> bool
+        {
+            return lhs.position != rhs.position;
+        }
+
+        [[nodiscard]] constexpr auto operator<(const const_iterator& rhs
+        ) const noexcept -> bool
+        {
+            return position < rhs.position;
+        }
+
+        [[nodiscard]] constexpr auto operator>(const const_iterator& rhs
+        ) const noexcept -> bool
+        {
+            return rhs.position < position;
+        }
+
+        [[nodiscard]] constexpr auto operator<=(const const_iterator& rhs
+        ) const noexcept -> bool
+        {
+            return position <= rhs.position;
+        }
+
+        [[nodiscard]] constexpr auto operator>=(const const_iterator& rhs
+        ) const noexcept -> bool
+        {
+            return position >= rhs.position;
+        }
+
+    private:
+
+        friend class iota_nd;
+
+        // Moves to the first index of the next tile,
+        // in row-major order of tiles
+        constexpr void p_next_tile() noexcept
+        {
+            for ( std::size_t dim {N}; dim != 0; --dim )
+            {
+                if ( tile_end[dim - 1] < extents[dim - 1] )
+                {
+                    tile_begin[dim - 1] = tile_end[dim - 1];
+                    index[dim - 1]      = tile_end[dim - 1];
+                    tile_end[dim - 1]   = std::min(
+                      tile_end[dim - 1] + tile[dim - 1], extents[dim - 1]
+                    );
+                    return;
+                }
+                tile_begin[dim - 1] = 0;
+                index[dim - 1]      = 0;
+                tile_end[dim - 1]   = std::min(tile[dim - 1], extents[dim - 1]);
+            }
+        }
+
+        [[nodiscard]] constexpr auto p_at_tile_start() const noexcept
+          -> bool
+        {
+            return index == tile_begin;
+        }
+
+        [[nodiscard]] constexpr auto p_tile_size() const noexcept
+          -> std::size_t
+        {
+            std::size_t product {1};
+            for ( std::size_t dim {0}; dim != N; ++dim )
+            {
+                product *= tile_end[dim] - tile_begin[dim];
+            }
+            return product;
+        }
+
+        // Traversal order is lexicographic in
+        // (tile coordinates..., coordinates within the tile...).
+        // Fixing a prefix of tile coordinates fixes those tiles' extents
+        // in the leading dimensions, and the whole grid remains
+        // in the others, so each coordinate is one division.
+        constexpr void p_locate() noexcept
+        {
+            if ( position >= size )
+            {
+                index      = extents_type {};
+                tile_begin = extents_type {};
+                tile_end   = extents_type {};
+                return;
+            }
+
+            extents_type trailing {};
+            trailing[N - 1] = 1;
+            for ( std::size_t dim {N - 1}; dim != 0; --dim )
+            {
+                trailing[dim - 1] = trailing[dim] * extents[dim];
+            }
+
+            std::size_t leading {1};
+            std::size_t remaining {position};
+
+            for ( std::size_t dim {0}; dim != N; ++dim )
+            {
+                const std::size_t tile_span {
+                  leading * tile[dim] * trailing[dim]};
+                const std::size_t tile_coord {remaining / tile_span};
+                remaining -= tile_coord * tile_span;
+
+                tile_begin[dim] = tile_coord * tile[dim];
+                tile_end[dim] =
+                  std::min(tile_begin[dim] + tile[dim], extents[dim]);
+                leading *= tile_end[dim] - tile_begin[dim];
+            }
+
+            for ( std::size_t dim {N}; dim != 0; --dim )
+            {
+                const std::size_t tile_extent {
+                  tile_end[dim - 1] - tile_begin[dim - 1]};
+                index[dim - 1] = tile_begin[dim - 1] + remaining % tile_extent;
+                remaining /= tile_extent;
+            }
+        }
+
+        template <std::size_t... Idxs>
+        [[nodiscard]] constexpr static auto
+        p_to_tuple(const extents_type& indices, std::index_sequence<Idxs...>)
+          -> index_type
+        {
+            return index_type {indices[Idxs]...};
+        }
+    };
+
+    /* }}} */
+
+    // Calls `func` on every index of the tile [first, last),
+    // one loop per dimension
+    template <std::size_t Dim, typename Func, typename... Indices>
+    constexpr static void p_visit_tile(
+      const extents_type& first, const extents_type& last, Func& func,
+      const Indices... indices
+    )
+    {
+        if constexpr ( Dim == N )
+        {
+            func(index_type {indices...});
+        }
+        else
+        {
+            for ( std::size_t index {first[Dim]}; index != last[Dim];
+                  ++index )
+            {
+                p_visit_tile<Dim + 1>(first, last, func, indices..., index);
+            }
+        }
+    }
+
+    constexpr iota_nd(
+      const extents_type& extents, const extents_type& tile,
+      const iota<std::size_t>& positions
+    ) noexcept
+            : m_extents {extents}
+            , m_tile {tile}
+            , m_positions {positions}
+    {
+    }
+
+public:
+
+    using iterator = const_iterator;
+
+    /* {{{ doc */
+    /**
+   * @brief Index space of a grid, visited in row-major order.
+   *
+   * @param extents Number of indices in each dimension.
+   */
+    /* }}} */
+    constexpr explicit iota_nd(const extents_type& extents) noexcept
+            : iota_nd {extents, extents}
+    {
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Index space of a grid, visited one tile at a time.
+   *
+   * @param extents Number of indices in each dimension.
+   *
+   * @param tile Number of indices in each dimension of a tile.
+   * Clamped to between one and the grid's extent.
+   */
+    /* }}} */
+    constexpr iota_nd(
+      const extents_type& extents, const extents_type& tile
+    ) noexcept
+            : m_extents {extents}
+            , m_tile {p_clamp_tile(extents, tile)}
+            , m_positions {0, p_product(extents)}
+    {
+    }
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator
+    {
+        return const_iterator {m_extents, m_tile, *m_positions.begin()};
+    }
+
+    [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator
+    {
+        return this->begin();
+    }
+
+    [[nodiscard]] constexpr auto end() const noexcept -> const_iterator
+    {
+        return const_iterator {m_extents, m_tile, *m_positions.end()};
+    }
+
+    [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator
+    {
+        return this->end();
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+    {
+        return m_positions.size();
+    }
+
+    [[nodiscard]] constexpr auto extents() const noexcept
+      -> const extents_type&
+    {
+        return m_extents;
+    }
+
+    [[nodiscard]] constexpr auto tile() const noexcept -> const extents_type&
+    {
+        return m_tile;
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Applies `func` to each index, in traversal order.
+   *
+   * @details Whole tiles are visited with one loop per dimension,
+   * which is faster than stepping an iterator.
+   * Only the partial tiles at either end of a chunk
+   * are visited by iterator.
+   *
+   * @return `func`
+   */
+    /* }}} */
+    template <typename Func>
+    constexpr auto for_each(Func&& func) const -> Func
+    {
+        const_iterator itr {this->begin()};
+        const const_iterator last {this->end()};
+
+        for ( ; itr != last && ! itr.p_at_tile_start(); ++itr )
+        {
+            func(*itr);
+        }
+
+        while ( itr != last )
+        {
+            const std::size_t tile_size {itr.p_tile_size()};
+            if ( last.position - itr.position < tile_size )
+            {
+                break;
+            }
+
+            p_visit_tile<0>(itr.tile_begin, itr.tile_end, func);
+            itr.position += tile_size;
+            itr.p_next_tile();
+        }
+
+        for ( ; itr != last; ++itr )
+        {
+            func(*itr);
+        }
+
+        return std::forward<Func>(func);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief One of `chunk_count` contiguous parts of the traversal,
+   * which differ in size by at most one index.
+   * Visiting every chunk visits every index exactly once.
+   *
+   * @pre `chunk` must be less than `chunk_count`.
+   */
+    /* }}} */
+    [[nodiscard]] constexpr auto
+    chunk(const std::size_t chunk_count, const std::size_t chunk) const noexcept
+      -> iota_nd
+    {
+        const std::size_t first {*m_positions.begin()};
+        const std::size_t size {this->size()};
+
+        const std::size_t chunk_first {
+          first + ::supl::impl::parallel_chunk_begin(size, chunk_count, chunk)};
+        const std::size_t chunk_last {
+          first
+          + ::supl::impl::parallel_chunk_begin(size, chunk_count, chunk + 1)};
+
+        return iota_nd {
+          m_extents, m_tile, iota<std::size_t> {chunk_first, chunk_last}};
+    }
+};
+
+namespace impl
+{
+    // Iterator type of `Range` as held by a view.
+    // `Range` is a reference if the view refers to a range,
+    // or a value type if it owns one.
+    template <typename Range>
+    using view_iterator_t =
+      decltype(std::begin(std::declval<const Range&>()));
+
+    // Strongest standard iterator category of `Itr`,
+    // no stronger than `Cap`
+    template <typename Itr, typename Cap>
+    using view_category_t = std::conditional_t<
+      std::is_base_of_v<
+        Cap, typename std::iterator_traits<Itr>::iterator_category>,
+      Cap, typename std::iterator_traits<Itr>::iterator_category>;
+}  // namespace impl
+
+/* {{{ doc */
+/**
+ * @brief Lazy view of the elements of a range which satisfy a predicate.
+ * Created by `fr::filter`.
+ *
+ * @details Iterators are forward iterators.
+ * `begin` searches for the first element satisfying the predicate
+ * each time it is called.
+ */
+/* }}} */
+template <typename Range, typename Pred>
+class filter_view : public view_base
+{
+private:
+
+    using base_iterator = impl::view_iterator_t<Range>;
+
+    Range m_base;
+    Pred m_pred;
+
+    /* {{{ iterator */
+    class iterator_type
+    {
+    private:
+
+        const filter_view* m_view {nullptr};
+        base_iterator m_current {};
+
+        constexpr void p_satisfy()
+        {
+            const base_iterator last {std::end(m_view->m_base)};
+            while ( m_current != last && ! m_view->m_pred(*m_current) )
+            {
+                ++m_current;
+            }
+        }
+
+    public:
+
+        using value_type =
+          typename std::iterator_traits<base_iterator>::value_type;
+        using difference_type =
+          typename std::iterator_traits<base_iterator>::difference_type;
+        using pointer = typename std::iterator_traits<base_iterator>::pointer;
+        using reference =
+          typename std::iterator_traits<base_iterator>::reference;
+        using iterator_category = std::forward_iterator_tag;
+
+        constexpr iterator_type() = default;
+
+        constexpr iterator_type(
+          const filter_view* view, const base_iterator current
+        )
+                : m_view {view}
+                , m_current {current}
+        {
+            this->p_satisfy();
+        }
+
+        constexpr auto operator++() -> iterator_type&
+        {
+            ++m_current;
+            this->p_satisfy();
+            return *this;
+        }
+
+        [[nodiscard]] constexpr auto operator++(int) -> iterator_type
+        {
+            iterator_type copy {*this};
+            this->operator++();
+            return copy;
+        }
+
+        [[nodiscard]] constexpr auto operator*() const -> reference
+        {
+            return *m_current;
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const iterator_type& lhs, const iterator_type& rhs)
+          -> bool
+        {
+            return lhs.m_current == rhs.m_current;
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator!=(const iterator_type& lhs, const iterator_type& rhs)
+          -> bool
+        {
+            return ! (lhs == rhs);
+        }
+    };
+
+    /* }}} */
+
+public:
+
+    using iterator       = iterator_type;
+    using const_iterator = iterator_type;
+
+    // NOLINTNEXTLINE(*rvalue-reference-param-not-moved*)
+    constexpr filter_view(Range&& base, Pred pred)
+            : m_base {std::forward<Range>(base)}
+            , m_pred {std::move(pred)}
+    {
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> iterator
+    {
+        return iterator {this, std::begin(m_base)};
+    }
+
+    [[nodiscard]] constexpr auto end() const -> iterator
+    {
+        return iterator {this, std::end(m_base)};
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Applies `func` to each element satisfying the predicate,
+   * within the loop over the underlying range.
+   *
+   * @return `func`
+   */
+    /* }}} */
+    template <typename Func>
+    constexpr auto for_each(Func&& func) const -> Func
+    {
+        ::supl::fr::for_each(
+          m_base,
+          [this, &func](auto&& element)
+          {
+              if ( m_pred(element) )
+              {
+                  func(std::forward<decltype(element)>(element));
+              }
+          }
+        );
+
+        return std::forward<Func>(func);
+    }
+};
+
+/* {{{ doc */
+/**
+ * @brief Lazy view of a range with a function applied to each element.
+ * Created by `fr::transform`.
+ *
+ * @details Iterators support the same operations as those of the range,
+ * and dereference to the result of the function.
+ * They are of the same category if the function returns an lvalue
+ * reference, otherwise they are input iterators,
+ * as forward iterators must yield references.
+ * The function is called each time an iterator is dereferenced.
+ */
+/* }}} */
+template <typename Range, typename Func>
+class transform_view : public view_base
+{
+private:
+
+    using base_iterator = impl::view_iterator_t<Range>;
+
+    Range m_base;
+    Func m_func;
+
+    /* {{{ iterator */
+    class iterator_type
+    {
+    private:
+
+        constexpr static bool is_bidirectional_tier {
+          is_bidirectional_v<base_iterator>};
+        constexpr static bool is_random_access_tier {
+          is_random_access_v<base_iterator>};
+
+        const Func* m_func {nullptr};
+        base_iterator m_current {};
+
+    public:
+
+        using reference = decltype(std::declval<const Func&>()(
+          *std::declval<const base_iterator&>()
+        ));
+        using value_type = remove_cvref_t<reference>;
+        using difference_type =
+          typename std::iterator_traits<base_iterator>::difference_type;
+        using pointer = void;
+        // Forward iterators must yield references, so where `func`
+        // returns by value the traversal operators of the base iterator
+        // remain, but the category is only input
+        using iterator_category = std::conditional_t<
+          std::is_lvalue_reference_v<reference>,
+          impl::view_category_t<base_iterator, std::random_access_iterator_tag>,
+          std::input_iterator_tag>;
+
+        constexpr iterator_type() = default;
+
+        constexpr iterator_type(const Func* func, const base_iterator current)
+                : m_func {func}
+                , m_current {current}
+        {
+        }
+
+        constexpr auto operator++() -> iterator_type&
+        {
+            ++m_current;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr auto operator++(int) -> iterator_type
+        {
+            iterator_type copy {*this};
+            this->operator++();
+            return copy;
+        }
+
+        [[nodiscard]] constexpr auto operator*() const -> reference
+        {
+            return (*m_func)(*m_current);
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const iterator_type& lhs, const iterator_type& rhs)
+          -> bool
+        {
+            return lhs.m_current == rhs.m_current;
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator!=(const iterator_type& lhs, const iterator_type& rhs)
+          -> bool
+        {
+            return ! (lhs == rhs);
+        }
+
+        ///////////////////////////////////////////// bidirectional tier
+
+        template <
+          bool Bidirectional = is_bidirectional_tier,
+          typename           = std::enable_if_t<Bidirectional>>
+        constexpr auto operator--() -> iterator_type&
+        {
+            --m_current;
+            return *this;
+        }
+
+        template <
+          bool Bidirectional = is_bidirectional_tier,
+          typename           = std::enable_if_t<Bidirectional>>
+        [[nodiscard]] constexpr auto operator--(int) -> iterator_type
+        {
+            iterator_type copy {*this};
+            --m_current;
+            return copy;
+        }
+
+        ///////////////////////////////////////////// random access tier
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        constexpr auto operator+=(const difference_type n)
+          -> iterator_type&
+        {
+            m_current += n;
+            return *this;
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        constexpr auto operator-=(const difference_type n)
+          -> iterator_type&
+        {
+            m_current -= n;
+            return *this;
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator+(const difference_type n
+        ) const -> iterator_type
+        {
+            return iterator_type {m_func, m_current + n};
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] friend constexpr auto
+        operator+(const difference_type n, const iterator_type& itr)
+          -> iterator_type
+        {
+            return itr + n;
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator-(const difference_type n
+        ) const -> iterator_type
+        {
+            return iterator_type {m_func, m_current - n};
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator-(const iterator_type& rhs
+        ) const -> difference_type
+        {
+            return m_current - rhs.m_current;
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator[](const difference_type n
+        ) const -> reference
+        {
+            return (*m_func)(m_current[n]);
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator<(const iterator_type& rhs
+        ) const -> bool
+        {
+            return m_current < rhs.m_current;
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator>(const iterator_type& rhs
+        ) const -> bool
+        {
+            return rhs.m_current < m_current;
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator<=(const iterator_type& rhs
+        ) const -> bool
+        {
+            return ! (rhs.m_current < m_current);
+        }
+
+        template <
+          bool Random_Access = is_random_access_tier,
+          typename           = std::enable_if_t<Random_Access>>
+        [[nodiscard]] constexpr auto operator>=(const iterator_type& rhs
+        ) const -> bool
+        {
+            return ! (m_current < rhs.m_current);
+        }
+    };
+
+    /* }}} */
+
+public:
+
+    using iterator       = iterator_type;
+    using const_iterator = iterator_type;
+
+    // NOLINTNEXTLINE(*rvalue-reference-param-not-moved*)
+    constexpr transform_view(Range&& base, Func func)
+            : m_base {std::forward<Range>(base)}
+            , m_func {std::move(func)}
+    {
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> iterator
+    {
+        return iterator {&m_func, std::begin(m_base)};
+    }
+
+    [[nodiscard]] constexpr auto end() const -> iterator
+    {
+        return iterator {&m_func, std::end(m_base)};
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Applies `func` to the transformed value of each element,
+   * within the loop over the underlying range.
+   *
+   * @return `func`
+   */
+    /* }}} */
+    template <typename Consumer>
+    constexpr auto for_each(Consumer&& func) const -> Consumer
+    {
+        ::supl::fr::for_each(
+          m_base,
+          [this, &func](auto&& element)
+          {
+              func(m_func(std::forward<decltype(element)>(element)));
+          }
+        );
+
+        return std::forward<Consumer>(func);
+    }
+};
+
+/* {{{ doc */
+/**
+ * @brief Lazy view of at most the first `count` elements of a range.
+ * Created by `fr::take`.
+ *
+ * @details If the range is random access, iterators are those of the range.
+ * Otherwise they are forward iterators which also count
+ * the elements remaining.
+ */
+/* }}} */
+template <typename Range>
+class take_view : public view_base
+{
+private:
+
+    using base_iterator = impl::view_iterator_t<Range>;
+
+    constexpr static bool is_random_access {
+      is_random_access_v<base_iterator>};
+
+    Range m_base;
+    std::size_t m_count;
+
+    /* {{{ counted_iterator */
+    class counted_iterator
+    {
+    private:
+
+        base_iterator m_current {};
+        std::size_t m_remaining {0};
+
+    public:
+
+        using value_type =
+          typename std::iterator_traits<base_iterator>::value_type;
+        using difference_type =
+          typename std::iterator_traits<base_iterator>::difference_type;
+        using pointer = typename std::iterator_traits<base_iterator>::pointer;
+        using reference =
+          typename std::iterator_traits<base_iterator>::reference;
+        using iterator_category =
+          impl::view_category_t<base_iterator, std::forward_iterator_tag>;
+
+        constexpr counted_iterator() = default;
+
+        constexpr counted_iterator(
+          const base_iterator current, const std::size_t remaining
+        )
+                : m_current {current}
+                , m_remaining {remaining}
+        {
+        }
+
+        // Once the count runs out the underlying iterator is left alone,
+        // so earlier stages do no work looking for an unwanted element
+        constexpr auto operator++() -> counted_iterator&
+        {
+            --m_remaining;
+            if ( m_remaining != 0 )
+            {
+                ++m_current;
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr auto operator++(int) -> counted_iterator
+        {
+            counted_iterator copy {*this};
+            this->operator++();
+            return copy;
+        }
+
+        [[nodiscard]] constexpr auto operator*() const -> reference
+        {
+            return *m_current;
+        }
+
+        // The end is reached either when the count runs out,
+        // or when the underlying range does
+        [[nodiscard]] friend constexpr auto
+        operator==(const counted_iterator& lhs, const counted_iterator& rhs)
+          -> bool
+        {
+            return lhs.m_remaining == rhs.m_remaining
+                || lhs.m_current == rhs.m_current;
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator!=(const counted_iterator& lhs, const counted_iterator& rhs)
+          -> bool
+        {
+            return ! (lhs == rhs);
+        }
+    };
+
+    /* }}} */
+
+public:
+
+    using iterator = std::
+      conditional_t<is_random_access, base_iterator, counted_iterator>;
+    using const_iterator = iterator;
+
+    // NOLINTNEXTLINE(*rvalue-reference-param-not-moved*)
+    constexpr take_view(Range&& base, const std::size_t count)
+            : m_base {std::forward<Range>(base)}
+            , m_count {count}
+    {
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> iterator
+    {
+        if constexpr ( is_random_access )
+        {
+            return std::begin(m_base);
+        }
+        else
+        {
+            return iterator {std::begin(m_base), m_count};
+        }
+    }
+
+    [[nodiscard]] constexpr auto end() const -> iterator
+    {
+        if constexpr ( is_random_access )
+        {
+            const auto first {std::begin(m_base)};
+            const auto size {std::end(m_base) - first};
+            return first
+                 + std::min(size, static_cast<decltype(size)>(m_count));
+        }
+        else
+        {
+            return iterator {std::end(m_base), 0};
+        }
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Applies `func` to each element of the view,
+   * stopping once `count` elements have been visited.
+   *
+   * @return `func`
+   */
+    /* }}} */
+    template <typename Func>
+    constexpr auto for_each(Func&& func) const -> Func
+    {
+        const iterator last {this->end()};
+        for ( iterator itr {this->begin()}; itr != last; ++itr )
+        {
+            func(*itr);
+        }
+
+        return std::forward<Func>(func);
+    }
+};
+
+/* {{{ doc */
+/**
+ * @brief Lazy view of a range without its first `count` elements.
+ * Created by `fr::drop`.
+ *
+ * @details Iterators are those of the range.
+ * Unless the range is random access, `begin` steps past
+ * the dropped elements each time it is called.
+ */
+/* }}} */
+template <typename Range>
+class drop_view : public view_base
+{
+private:
+
+    using base_iterator = impl::view_iterator_t<Range>;
+
+    Range m_base;
+    std::size_t m_count;
+
+public:
+
+    using iterator       = base_iterator;
+    using const_iterator = base_iterator;
+
+    // NOLINTNEXTLINE(*rvalue-reference-param-not-moved*)
+    constexpr drop_view(Range&& base, const std::size_t count)
+            : m_base {std::forward<Range>(base)}
+            , m_count {count}
+    {
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> iterator
+    {
+        auto first {std::begin(m_base)};
+        const auto last {std::end(m_base)};
+
+        if constexpr ( is_random_access_v<base_iterator> )
+        {
+            const auto size {last - first};
+            return first
+                 + std::min(size, static_cast<decltype(size)>(m_count));
+        }
+        else
+        {
+            for ( std::size_t i {0}; i != m_count && first != last; ++i )
+            {
+                ++first;
+            }
+            return first;
+        }
+    }
+
+    [[nodiscard]] constexpr auto end() const -> iterator
+    {
+        return std::end(m_base);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Applies `func` to each element of the view.
+   *
+   * @return `func`
+   */
+    /* }}} */
+    template <typename Func>
+    constexpr auto for_each(Func&& func) const -> Func
+    {
+        const iterator last {this->end()};
+        for ( iterator itr {this->begin()}; itr != last; ++itr )
+        {
+            func(*itr);
+        }
+
+        return std::forward<Func>(func);
+    }
+};
+
+/* {{{ doc */
+/**
+ * @brief Lazily selects the elements of `container` satisfying `pred`.
+ *
+ * @details No element is visited until the view is iterated.
+ * Views may be passed to other views and to the algorithms in `supl::fr`,
+ * and `fr::for_each` visits every stage in a single loop
+ * over the underlying range.
+ * If `container` is an lvalue, the view refers to it,
+ * and it must outlive the view.
+ * Otherwise the view owns it.
+ * Usage: `fr::transform(fr::filter(vec, pred), func)`
+ *
+ * @param pred Predicate, callable when const.
+ */
+/* }}} */
+template <typename Container, typename Pred>
+[[nodiscard]] constexpr auto filter(Container&& container, Pred&& pred)
+  -> filter_view<Container, std::decay_t<Pred>>
+{
+    return filter_view<Container, std::decay_t<Pred>> {
+      std::forward<Container>(container), std::forward<Pred>(pred)};
+}
+
+/* {{{ doc */
+/**
+ * @brief Lazily applies `func` to each element of `container`.
+ *
+ * @details See `fr::filter` for how views hold their range.
+ *
+ * @param func Unary function, callable when const.
+ */
+/* }}} */
+template <typename Container, typename Func>
+[[nodiscard]] constexpr auto transform(Container&& container, Func&& func)
+  -> transform_view<Container, std::decay_t<Func>>
+{
+    return transform_view<Container, std::decay_t<Func>> {
+      std::forward<Container>(container), std::forward<Func>(func)};
+}
+
+/* {{{ doc */
+/**
+ * @brief Lazily selects at most the first `count` elements of `container`.
+ *
+ * @details See `fr::filter` for how views hold their range.
+ */
+/* }}} */
+template <typename Container>
+[[nodiscard]] constexpr auto
+take(Container&& container, const std::size_t count)
+  -> take_view<Container>
+{
+    return take_view<Container> {std::forward<Container>(container), count};
+}
+
+/* {{{ doc */
+/**
+ * @brief Lazily skips the first `count` elements of `container`.
+ *
+ * @details See `fr::filter` for how views hold their range.
+ */
+/* }}} */
+template <typename Container>
+[[nodiscard]] constexpr auto
+drop(Container&& container, const std::size_t count)
+  -> drop_view<Container>
+{
+    return drop_view<Container> {std::forward<Container>(container), count};
+}
+
+}  // namespace supl::fr
+
+namespace supl
+{
+
+// Iterators of index ranges compute their values,
+// so they do not refer into the range object
+
+template <typename T>
+struct is_borrowed_range<fr::iota<T>> : std::true_type
+{
+};
+
+template <std::size_t N>
+struct is_borrowed_range<fr::iota_nd<N>> : std::true_type
+{
+};
+
+}  // namespace supl
 
 #endif
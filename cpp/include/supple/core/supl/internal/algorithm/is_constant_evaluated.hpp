@@ -0,0 +1,30 @@
+#ifndef SUPPLE_CORE_INTERNAL_IS_CONSTANT_EVALUATED_HPP
+#define SUPPLE_CORE_INTERNAL_IS_CONSTANT_EVALUATED_HPP
+
+#include <type_traits>
+
+namespace supl::impl
+{
+
+// `std::is_constant_evaluated` is C++20,
+// but the builtin behind it is usually available in C++17.
+// Where it is not, every evaluation is assumed to be constant,
+// so callers conservatively take their constexpr-friendly path.
+[[nodiscard]] constexpr auto is_constant_evaluated() noexcept -> bool
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+#else
+    return true;
+#endif
+}
+
+}  // namespace supl::impl
+
+#endif
@@ -0,0 +1,201 @@
+#ifndef SUPPLE_CORE_INTERNAL_PARALLEL_HPP
+#define SUPPLE_CORE_INTERNAL_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace supl
+{
+
+/* {{{ doc */
+/**
+ * @brief Execution policy requesting that an algorithm
+ * split its work across several threads.
+ *
+ * @details Algorithms taking this policy require random access iterators,
+ * and any callables passed to them must be safe to call concurrently.
+ * Exceptions thrown on worker threads are rethrown on the calling thread.
+ * If several are thrown, the one from the earliest part
+ * of the input is rethrown.
+ */
+/* }}} */
+struct parallel_policy
+{
+    /* {{{ doc */
+    /**
+   * @brief Number of threads to use, including the calling thread.
+   *
+   * @details If zero, `std::thread::hardware_concurrency()` is used,
+   * and small inputs are not split.
+   */
+    /* }}} */
+    std::size_t thread_count {0};
+};
+
+/* {{{ doc */
+/**
+ * @brief Default parallel execution policy,
+ * using one thread per hardware thread.
+ */
+/* }}} */
+constexpr inline parallel_policy par {};
+
+namespace impl
+{
+    // Below this many elements per chunk,
+    // starting a thread costs more than it saves
+    constexpr inline std::size_t parallel_min_chunk_size {4096};
+
+    // Number of chunks to split `size` elements into.
+    // Always at least one, and never more than there are
+    // groups of `granularity` elements.
+    [[nodiscard]] inline auto parallel_chunk_count(
+      const parallel_policy policy, const std::size_t size,
+      const std::size_t granularity = 1
+    ) -> std::size_t
+    {
+        if ( policy.thread_count != 0 )
+        {
+            return std::clamp(
+              policy.thread_count, std::size_t {1},
+              std::max(
+                (size + granularity - 1) / granularity, std::size_t {1}
+              )
+            );
+        }
+
+        // querying this may be a system call, so only do it once
+        static const std::size_t hardware {std::max(
+          static_cast<std::size_t>(std::thread::hardware_concurrency()),
+          std::size_t {1}
+        )};
+
+        return std::clamp(
+          size / parallel_min_chunk_size, std::size_t {1}, hardware
+        );
+    }
+
+    // Assumed size of a cache line.
+    // `std::hardware_destructive_interference_size` is not reliably
+    // available in C++17.
+    constexpr inline std::size_t parallel_cache_line_size {64};
+
+    // Number of elements of each type in `Ts` which can share a cache line
+    // with at least one element of every other type in `Ts`.
+    // Chunk boundaries which are multiples of this never split a cache line
+    // between two threads, provided the ranges begin on a cache line.
+    template <typename... Ts>
+    constexpr inline std::size_t parallel_cache_line_granularity {std::max(
+      {std::size_t {1}, (parallel_cache_line_size / sizeof(Ts))...}
+    )};
+
+    // Index of the first element of `chunk`
+    // when `size` elements are split into `chunk_count` near-equal chunks,
+    // with every boundary but the end a multiple of `granularity`
+    [[nodiscard]] constexpr auto parallel_chunk_begin(
+      const std::size_t size, const std::size_t chunk_count,
+      const std::size_t chunk, const std::size_t granularity = 1
+    ) noexcept -> std::size_t
+    {
+        const std::size_t blocks {(size + granularity - 1) / granularity};
+        return std::min(
+          ((blocks / chunk_count) * chunk
+           + std::min(chunk, blocks % chunk_count))
+            * granularity,
+          size
+        );
+    }
+
+    // Calls `func(chunk, chunk_begin, chunk_end)` for each of `chunk_count`
+    // contiguous chunks of [0, size), each on its own thread.
+    // Every chunk boundary but the end is a multiple of `granularity`,
+    // so some chunks may be empty if `size` is small.
+    // The last chunk runs on the calling thread.
+    // If a thread cannot be started, its chunk runs on the calling thread.
+    // Once every chunk has finished, the exception from the lowest
+    // numbered chunk which threw, if any, is rethrown.
+    template <typename Func>
+    void parallel_chunks(
+      const std::size_t size, const std::size_t chunk_count, Func&& func,
+      const std::size_t granularity = 1
+    )
+    {
+        if ( chunk_count == 1 )
+        {
+            func(std::size_t {0}, std::size_t {0}, size);
+            return;
+        }
+
+        std::vector<std::exception_ptr> errors(chunk_count);
+
+        const auto run_chunk {
+          [size, chunk_count, granularity, &func,
+           &errors](const std::size_t chunk) noexcept
+          {
+              try
+              {
+                  func(
+                    chunk,
+                    parallel_chunk_begin(
+                      size, chunk_count, chunk, granularity
+                    ),
+                    parallel_chunk_begin(
+                      size, chunk_count, chunk + 1, granularity
+                    )
+                  );
+              }
+              catch ( ... )
+              {
+                  errors[chunk] = std::current_exception();
+              }
+          }
+        };
+
+        std::vector<std::thread> threads;
+        std::size_t chunk {0};
+
+        try
+        {
+            threads.reserve(chunk_count - 1);
+            for ( ; chunk + 1 < chunk_count; ++chunk )
+            {
+                threads.emplace_back(run_chunk, chunk);
+            }
+        }
+        catch ( const std::system_error& )
+        {
+            // fall through and run the remaining chunks here
+        }
+        catch ( const std::bad_alloc& )
+        {
+            // likewise
+        }
+
+        for ( ; chunk != chunk_count; ++chunk )
+        {
+            run_chunk(chunk);
+        }
+
+        for ( std::thread& thread : threads )
+        {
+            thread.join();
+        }
+
+        for ( const std::exception_ptr& error : errors )
+        {
+            if ( error )
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}  // namespace impl
+
+}  // namespace supl
+
+#endif
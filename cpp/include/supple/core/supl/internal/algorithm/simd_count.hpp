@@ -0,0 +1,363 @@
+#ifndef SUPPLE_CORE_INTERNAL_SIMD_COUNT_HPP
+#define SUPPLE_CORE_INTERNAL_SIMD_COUNT_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include "simd_find.hpp"
+
+#if ( defined(__GNUC__) || defined(__clang__) )                           \
+  && ( defined(__x86_64__) || defined(__i386__) ) && defined(__SSE2__)
+#define SUPPLE_INTERNAL_SIMD_COUNT_X86
+#include <immintrin.h>
+#endif
+
+namespace supl::impl
+{
+
+// Comparisons the counting kernels support.
+// `between` is inclusive of both bounds.
+enum class simd_comparison
+{
+    equal,
+    less,
+    greater,
+    between
+};
+
+// Whether `element` satisfies `Comparison` against `first`,
+// and `second` if it is `between`
+template <simd_comparison Comparison, typename T>
+[[nodiscard]] constexpr auto simd_compare_scalar(
+  const T element, const T first, const T second
+) noexcept -> bool
+{
+    if constexpr ( Comparison == simd_comparison::equal )
+    {
+        // `std::equal_to` as `T` may be floating point
+        return std::equal_to<> {}(element, first);
+    }
+    else if constexpr ( Comparison == simd_comparison::less )
+    {
+        return element < first;
+    }
+    else if constexpr ( Comparison == simd_comparison::greater )
+    {
+        return element > first;
+    }
+    else
+    {
+        return first <= element && element <= second;
+    }
+}
+
+template <simd_comparison Comparison, typename T>
+[[nodiscard]] constexpr auto simd_count_scalar(
+  const T* begin, const T* const end, const T first, const T second
+) noexcept -> std::ptrdiff_t
+{
+    std::ptrdiff_t count {0};
+    for ( ; begin != end; ++begin )
+    {
+        if ( simd_compare_scalar<Comparison>(*begin, first, second) )
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+#if defined(SUPPLE_INTERNAL_SIMD_COUNT_X86)
+
+// SSE2 has no 64-bit integer ordering
+template <typename T>
+constexpr inline bool is_simd_orderable_128_v {
+  std::is_floating_point_v<T> || sizeof(T) != 8};
+
+// Lanes of `lhs` greater than those of `rhs` are all ones, others zeros
+template <typename T>
+[[nodiscard]] inline auto
+simd_greater_128(__m128i lhs, __m128i rhs) noexcept -> __m128i
+{
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return _mm_castps_si128(
+          _mm_cmpgt_ps(_mm_castsi128_ps(lhs), _mm_castsi128_ps(rhs))
+        );
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        return _mm_castpd_si128(
+          _mm_cmpgt_pd(_mm_castsi128_pd(lhs), _mm_castsi128_pd(rhs))
+        );
+    }
+    else
+    {
+        static_assert(sizeof(T) != 8);
+
+        // flipping the sign bit orders unsigned lanes as signed ones
+        if constexpr ( std::is_unsigned_v<T> )
+        {
+            const __m128i sign {simd_broadcast_128(
+              static_cast<T>(T {1} << (sizeof(T) * 8 - 1))
+            )};
+            lhs = _mm_xor_si128(lhs, sign);
+            rhs = _mm_xor_si128(rhs, sign);
+        }
+
+        if constexpr ( sizeof(T) == 1 )
+        {
+            return _mm_cmpgt_epi8(lhs, rhs);
+        }
+        else if constexpr ( sizeof(T) == 2 )
+        {
+            return _mm_cmpgt_epi16(lhs, rhs);
+        }
+        else
+        {
+            return _mm_cmpgt_epi32(lhs, rhs);
+        }
+    }
+}
+
+// Lanes of `block` satisfying `Comparison` are all ones, others zeros
+template <simd_comparison Comparison, typename T>
+[[nodiscard]] inline auto simd_match_128(
+  const __m128i block, const __m128i first, const __m128i second
+) noexcept -> __m128i
+{
+    if constexpr ( Comparison == simd_comparison::equal )
+    {
+        return simd_equal_128<T>(block, first);
+    }
+    else if constexpr ( Comparison == simd_comparison::less )
+    {
+        return simd_greater_128<T>(first, block);
+    }
+    else if constexpr ( Comparison == simd_comparison::greater )
+    {
+        return simd_greater_128<T>(block, first);
+    }
+    else if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m128 value {_mm_castsi128_ps(block)};
+        return _mm_castps_si128(_mm_and_ps(
+          _mm_cmple_ps(_mm_castsi128_ps(first), value),
+          _mm_cmple_ps(value, _mm_castsi128_ps(second))
+        ));
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        const __m128d value {_mm_castsi128_pd(block)};
+        return _mm_castpd_si128(_mm_and_pd(
+          _mm_cmple_pd(_mm_castsi128_pd(first), value),
+          _mm_cmple_pd(value, _mm_castsi128_pd(second))
+        ));
+    }
+    else
+    {
+        // integers are between unless outside either bound
+        return _mm_andnot_si128(
+          _mm_or_si128(
+            simd_greater_128<T>(first, block),
+            simd_greater_128<T>(block, second)
+          ),
+          _mm_set1_epi32(-1)
+        );
+    }
+}
+
+template <simd_comparison Comparison, typename T>
+[[nodiscard]] inline auto simd_count_sse2(
+  const T* begin, const T* const end, const T first, const T second
+) noexcept -> std::ptrdiff_t
+{
+    constexpr std::ptrdiff_t lanes {16 / sizeof(T)};
+    const __m128i first_block {simd_broadcast_128(first)};
+    const __m128i second_block {simd_broadcast_128(second)};
+
+    // one mask bit per matching byte
+    std::ptrdiff_t matching_bytes {0};
+    for ( ; end - begin >= lanes; begin += lanes )
+    {
+        const __m128i block {
+          // NOLINTNEXTLINE(*reinterpret-cast*)
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin))};
+        matching_bytes += __builtin_popcount(static_cast<unsigned>(
+          _mm_movemask_epi8(simd_match_128<Comparison, T>(
+            block, first_block, second_block
+          ))
+        ));
+    }
+
+    return matching_bytes / static_cast<std::ptrdiff_t>(sizeof(T))
+         + simd_count_scalar<Comparison>(begin, end, first, second);
+}
+
+template <typename T>
+[[nodiscard]] __attribute__((target("avx2"))) inline auto
+simd_greater_256(__m256i lhs, __m256i rhs) noexcept -> __m256i
+{
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return _mm256_castps_si256(_mm256_cmp_ps(
+          _mm256_castsi256_ps(lhs), _mm256_castsi256_ps(rhs), _CMP_GT_OQ
+        ));
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        return _mm256_castpd_si256(_mm256_cmp_pd(
+          _mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs), _CMP_GT_OQ
+        ));
+    }
+    else
+    {
+        // flipping the sign bit orders unsigned lanes as signed ones
+        if constexpr ( std::is_unsigned_v<T> )
+        {
+            const __m256i sign {simd_broadcast_256(
+              static_cast<T>(T {1} << (sizeof(T) * 8 - 1))
+            )};
+            lhs = _mm256_xor_si256(lhs, sign);
+            rhs = _mm256_xor_si256(rhs, sign);
+        }
+
+        if constexpr ( sizeof(T) == 1 )
+        {
+            return _mm256_cmpgt_epi8(lhs, rhs);
+        }
+        else if constexpr ( sizeof(T) == 2 )
+        {
+            return _mm256_cmpgt_epi16(lhs, rhs);
+        }
+        else if constexpr ( sizeof(T) == 4 )
+        {
+            return _mm256_cmpgt_epi32(lhs, rhs);
+        }
+        else
+        {
+            return _mm256_cmpgt_epi64(lhs, rhs);
+        }
+    }
+}
+
+template <simd_comparison Comparison, typename T>
+[[nodiscard]] __attribute__((target("avx2"))) inline auto simd_match_256(
+  const __m256i block, const __m256i first, const __m256i second
+) noexcept -> __m256i
+{
+    if constexpr ( Comparison == simd_comparison::equal )
+    {
+        return simd_equal_256<T>(block, first);
+    }
+    else if constexpr ( Comparison == simd_comparison::less )
+    {
+        return simd_greater_256<T>(first, block);
+    }
+    else if constexpr ( Comparison == simd_comparison::greater )
+    {
+        return simd_greater_256<T>(block, first);
+    }
+    else if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 value {_mm256_castsi256_ps(block)};
+        return _mm256_castps_si256(_mm256_and_ps(
+          _mm256_cmp_ps(_mm256_castsi256_ps(first), value, _CMP_LE_OQ),
+          _mm256_cmp_ps(value, _mm256_castsi256_ps(second), _CMP_LE_OQ)
+        ));
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        const __m256d value {_mm256_castsi256_pd(block)};
+        return _mm256_castpd_si256(_mm256_and_pd(
+          _mm256_cmp_pd(_mm256_castsi256_pd(first), value, _CMP_LE_OQ),
+          _mm256_cmp_pd(value, _mm256_castsi256_pd(second), _CMP_LE_OQ)
+        ));
+    }
+    else
+    {
+        // integers are between unless outside either bound
+        return _mm256_andnot_si256(
+          _mm256_or_si256(
+            simd_greater_256<T>(first, block),
+            simd_greater_256<T>(block, second)
+          ),
+          _mm256_set1_epi32(-1)
+        );
+    }
+}
+
+template <simd_comparison Comparison, typename T>
+[[nodiscard]] __attribute__((target("avx2,popcnt"))) inline auto
+simd_count_avx2(
+  const T* begin, const T* const end, const T first, const T second
+) noexcept -> std::ptrdiff_t
+{
+    constexpr std::ptrdiff_t lanes {32 / sizeof(T)};
+    const __m256i first_block {simd_broadcast_256(first)};
+    const __m256i second_block {simd_broadcast_256(second)};
+
+    // one mask bit per matching byte
+    std::ptrdiff_t matching_bytes {0};
+    for ( ; end - begin >= lanes; begin += lanes )
+    {
+        const __m256i block {
+          // NOLINTNEXTLINE(*reinterpret-cast*)
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin))};
+        matching_bytes += __builtin_popcount(static_cast<unsigned>(
+          _mm256_movemask_epi8(simd_match_256<Comparison, T>(
+            block, first_block, second_block
+          ))
+        ));
+    }
+
+    return matching_bytes / static_cast<std::ptrdiff_t>(sizeof(T))
+         + simd_count_scalar<Comparison>(begin, end, first, second);
+}
+
+#endif
+
+// Count the elements of the contiguous range [begin, end)
+// which satisfy `Comparison` against `first`,
+// and `second` if it is `between`,
+// comparing a vector register's worth of elements at a time
+// where the target supports it.
+// AVX2 is chosen at runtime if the executing CPU supports it.
+template <simd_comparison Comparison, typename T>
+[[nodiscard]] inline auto simd_count(
+  const T* const begin, const T* const end, const T first,
+  const T second = T {}
+) noexcept -> std::ptrdiff_t
+{
+    static_assert(is_simd_searchable_v<T>);
+
+#if defined(SUPPLE_INTERNAL_SIMD_COUNT_X86)
+#if defined(__AVX2__) && defined(__POPCNT__)
+    return simd_count_avx2<Comparison>(begin, end, first, second);
+#else
+    if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") )
+    {
+        return simd_count_avx2<Comparison>(begin, end, first, second);
+    }
+
+    if constexpr ( Comparison == simd_comparison::equal
+                   || is_simd_orderable_128_v<T> )
+    {
+        return simd_count_sse2<Comparison>(begin, end, first, second);
+    }
+    else
+    {
+        return simd_count_scalar<Comparison>(begin, end, first, second);
+    }
+#endif
+#else
+    return simd_count_scalar<Comparison>(begin, end, first, second);
+#endif
+}
+
+}  // namespace supl::impl
+
+#undef SUPPLE_INTERNAL_SIMD_COUNT_X86
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef SUPPLE_CORE_INTERNAL_SIMD_FIND_HPP
+#define SUPPLE_CORE_INTERNAL_SIMD_FIND_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#if ( defined(__GNUC__) || defined(__clang__) )                           \
+  && ( defined(__x86_64__) || defined(__i386__) ) && defined(__SSE2__)
+#define SUPPLE_INTERNAL_SIMD_FIND_X86
+#include <immintrin.h>
+#endif
+
+namespace supl::impl
+{
+
+// Types for which `==` is a plain lane-wise comparison
+template <typename T>
+constexpr inline bool is_simd_searchable_v {
+  (std::is_integral_v<T> && ! std::is_same_v<T, bool>
+   && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4
+       || sizeof(T) == 8))
+  || std::is_same_v<T, float> || std::is_same_v<T, double>};
+
+#if defined(SUPPLE_INTERNAL_SIMD_FIND_X86)
+
+template <typename T>
+[[nodiscard]] inline auto simd_broadcast_128(const T value) noexcept
+  -> __m128i
+{
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return _mm_castps_si128(_mm_set1_ps(value));
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        return _mm_castpd_si128(_mm_set1_pd(value));
+    }
+    else if constexpr ( sizeof(T) == 1 )
+    {
+        return _mm_set1_epi8(static_cast<char>(value));
+    }
+    else if constexpr ( sizeof(T) == 2 )
+    {
+        return _mm_set1_epi16(static_cast<short>(value));
+    }
+    else if constexpr ( sizeof(T) == 4 )
+    {
+        return _mm_set1_epi32(static_cast<int>(value));
+    }
+    else
+    {
+        return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+}
+
+// Lanes equal to `needle` are all ones, others all zeros
+template <typename T>
+[[nodiscard]] inline auto
+simd_equal_128(const __m128i block, const __m128i needle) noexcept
+  -> __m128i
+{
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return _mm_castps_si128(
+          _mm_cmpeq_ps(_mm_castsi128_ps(block), _mm_castsi128_ps(needle))
+        );
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        return _mm_castpd_si128(
+          _mm_cmpeq_pd(_mm_castsi128_pd(block), _mm_castsi128_pd(needle))
+        );
+    }
+    else if constexpr ( sizeof(T) == 1 )
+    {
+        return _mm_cmpeq_epi8(block, needle);
+    }
+    else if constexpr ( sizeof(T) == 2 )
+    {
+        return _mm_cmpeq_epi16(block, needle);
+    }
+    else if constexpr ( sizeof(T) == 4 )
+    {
+        return _mm_cmpeq_epi32(block, needle);
+    }
+    else
+    {
+        // SSE2 has no 64-bit compare,
+        // so both 32-bit halves of a lane must match
+        const __m128i halves {_mm_cmpeq_epi32(block, needle)};
+        return _mm_and_si128(
+          halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))
+        );
+    }
+}
+
+template <typename T>
+[[nodiscard]] inline auto
+simd_contains_sse2(const T* begin, const T* const end, const T value) noexcept
+  -> bool
+{
+    constexpr std::ptrdiff_t lanes {16 / sizeof(T)};
+    const __m128i needle {simd_broadcast_128(value)};
+
+    for ( ; end - begin >= lanes; begin += lanes )
+    {
+        const __m128i block {
+          // NOLINTNEXTLINE(*reinterpret-cast*)
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin))};
+        if ( _mm_movemask_epi8(simd_equal_128<T>(block, needle)) != 0 )
+        {
+            return true;
+        }
+    }
+
+    return std::find(begin, end, value) != end;
+}
+
+template <typename T>
+[[nodiscard]] __attribute__((target("avx2"))) inline auto
+simd_broadcast_256(const T value) noexcept -> __m256i
+{
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return _mm256_castps_si256(_mm256_set1_ps(value));
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        return _mm256_castpd_si256(_mm256_set1_pd(value));
+    }
+    else if constexpr ( sizeof(T) == 1 )
+    {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    }
+    else if constexpr ( sizeof(T) == 2 )
+    {
+        return _mm256_set1_epi16(static_cast<short>(value));
+    }
+    else if constexpr ( sizeof(T) == 4 )
+    {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    }
+    else
+    {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+}
+
+template <typename T>
+[[nodiscard]] __attribute__((target("avx2"))) inline auto
+simd_equal_256(const __m256i block, const __m256i needle) noexcept
+  -> __m256i
+{
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return _mm256_castps_si256(_mm256_cmp_ps(
+          _mm256_castsi256_ps(block), _mm256_castsi256_ps(needle),
+          _CMP_EQ_OQ
+        ));
+    }
+    else if constexpr ( std::is_same_v<T, double> )
+    {
+        return _mm256_castpd_si256(_mm256_cmp_pd(
+          _mm256_castsi256_pd(block), _mm256_castsi256_pd(needle),
+          _CMP_EQ_OQ
+        ));
+    }
+    else if constexpr ( sizeof(T) == 1 )
+    {
+        return _mm256_cmpeq_epi8(block, needle);
+    }
+    else if constexpr ( sizeof(T) == 2 )
+    {
+        return _mm256_cmpeq_epi16(block, needle);
+    }
+    else if constexpr ( sizeof(T) == 4 )
+    {
+        return _mm256_cmpeq_epi32(block, needle);
+    }
+    else
+    {
+        return _mm256_cmpeq_epi64(block, needle);
+    }
+}
+
+template <typename T>
+[[nodiscard]] __attribute__((target("avx2"))) inline auto
+simd_contains_avx2(const T* begin, const T* const end, const T value) noexcept
+  -> bool
+{
+    constexpr std::ptrdiff_t lanes {32 / sizeof(T)};
+    const __m256i needle {simd_broadcast_256(value)};
+
+    for ( ; end - begin >= lanes; begin += lanes )
+    {
+        const __m256i block {
+          // NOLINTNEXTLINE(*reinterpret-cast*)
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin))};
+        if ( _mm256_movemask_epi8(simd_equal_256<T>(block, needle)) != 0 )
+        {
+            return true;
+        }
+    }
+
+    return std::find(begin, end, value) != end;
+}
+
+#endif
+
+// Determine if the contiguous range [begin, end) contains `value`,
+// comparing a vector register's worth of elements at a time
+// where the target supports it.
+// AVX2 is chosen at runtime if the executing CPU supports it.
+template <typename T>
+[[nodiscard]] inline auto
+simd_contains(const T* const begin, const T* const end, const T value) noexcept
+  -> bool
+{
+    static_assert(is_simd_searchable_v<T>);
+
+#if defined(SUPPLE_INTERNAL_SIMD_FIND_X86)
+#if defined(__AVX2__)
+    return simd_contains_avx2(begin, end, value);
+#else
+    if ( __builtin_cpu_supports("avx2") )
+    {
+        return simd_contains_avx2(begin, end, value);
+    }
+    return simd_contains_sse2(begin, end, value);
+#endif
+#else
+    return std::find(begin, end, value) != end;
+#endif
+}
+
+}  // namespace supl::impl
+
+#undef SUPPLE_INTERNAL_SIMD_FIND_X86
+
+#endif
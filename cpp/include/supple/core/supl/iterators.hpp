@@ -13,12 +13,19 @@
 #ifndef SUPPLE_CORE_ITERATORS_HPP
 #define SUPPLE_CORE_ITERATORS_HPP
 
+#include <array>
 #include <cstddef>
 #include <exception>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "metaprogramming.hpp"
 
@@ -95,6 +102,116 @@ struct is_iterator_tag : std::is_base_of<std::forward_iterator_tag, T>
 template <typename T>
 constexpr inline bool is_iterator_tag_v = is_iterator_tag<T>::value;
 
+namespace impl
+{
+    template <typename T>
+    constexpr inline bool is_char_type_v {is_type_in_pack_v<
+      T, char, wchar_t,
+#if defined(__cpp_char8_t)
+      char8_t,
+#endif
+      char16_t, char32_t>};
+
+    // libstdc++ implements the iterators of `std::vector`
+    // and `std::basic_string` by wrapping a pointer.
+    // Recognizing the wrapper avoids naming those containers,
+    // which would instantiate them with arbitrary value types.
+    template <typename T>
+    struct is_wrapped_pointer : std::false_type
+    {
+    };
+
+#if defined(__GLIBCXX__)
+    template <typename Pointer, typename Container>
+    struct is_wrapped_pointer<
+      __gnu_cxx::__normal_iterator<Pointer, Container>>
+            : std::is_pointer<Pointer>
+    {
+    };
+#endif
+
+    template <typename T>
+    constexpr auto is_contiguous_iterator_impl() noexcept -> bool
+    {
+        // a `const` value type must not name a container of `const`
+        using value_type =
+          std::remove_cv_t<typename std::iterator_traits<T>::value_type>;
+
+#if defined(__cpp_lib_concepts)
+        if constexpr ( std::contiguous_iterator<T> )
+        {
+            return true;
+        }
+#endif
+
+        // output iterators, such as `std::back_insert_iterator`
+        if constexpr ( std::is_void_v<value_type> )
+        {
+            return false;
+        }
+        else if constexpr ( std::is_pointer_v<T> )
+        {
+            return true;
+        }
+        else if constexpr ( is_wrapped_pointer<T>::value )
+        {
+            return true;
+        }
+        // only random access iterators can match those named below
+        else if constexpr ( not is_random_access_v<T> )
+        {
+            return false;
+        }
+        // `std::vector<bool>` is not contiguous
+        else if constexpr ( std::is_same_v<value_type, bool> )
+        {
+            return false;
+        }
+        else if constexpr ( is_char_type_v<value_type> )
+        {
+            return is_type_in_pack_v<
+              T, typename std::vector<value_type>::iterator,
+              typename std::vector<value_type>::const_iterator,
+              typename std::basic_string<value_type>::iterator,
+              typename std::basic_string<value_type>::const_iterator,
+              typename std::basic_string_view<value_type>::const_iterator>;
+        }
+        else
+        {
+            return is_type_in_pack_v<
+              T, typename std::vector<value_type>::iterator,
+              typename std::vector<value_type>::const_iterator>;
+        }
+    }
+}  // namespace impl
+
+/* {{{ doc */
+/**
+ * @brief Determines if an iterator is known to be contiguous.
+ *
+ * @details Pointers, and the iterators of `std::vector`,
+ * `std::basic_string`, and `std::basic_string_view` are recognized.
+ * If `std::contiguous_iterator` is available, anything satisfying it
+ * is also recognized.
+ * This may be specialized for other contiguous iterators.
+ */
+/* }}} */
+template <typename T, typename = void>
+struct is_contiguous_iterator : std::false_type
+{
+};
+
+template <typename T>
+struct is_contiguous_iterator<
+  T, std::void_t<typename std::iterator_traits<T>::value_type>>
+        : std::bool_constant<impl::is_contiguous_iterator_impl<T>()>
+{
+};
+
+template <typename T>
+constexpr inline bool is_contiguous_iterator_v =
+  is_contiguous_iterator<T>::value;
+
 class bad_iterator_access : public std::exception
 {
 public:
@@ -107,12 +224,20 @@ public:
 
 /* {{{ doc */
 /**
- * @brief Type erased wrapper for a bidirectional iterator
+ * @brief Type erased wrapper for a bidirectional or random access iterator
  *
  * @details This should work just like any bidirectional iterator.
  * Dereference, arrow operator, pre- and post-increment and decrement,
  * and equality comparison all work as expected.
  *
+ * If `Category` is `std::random_access_iterator_tag`,
+ * this also works like a random access iterator.
+ * Compound assignment, addition, subtraction, subscript,
+ * and relational comparison are each a single virtual call,
+ * so `std::advance` and `std::distance` are constant time.
+ * Only random access iterators may be erased at this tier.
+ * This is checked by a static_assert.
+ *
  * It is templated on the value_type of the erased iterator,
  * and cannot be reassigned to an iterator of a different value_type.
  * This is checked by a static_assert.
@@ -126,22 +251,36 @@ public:
  * as that would violate const-correctness.
  * This is checked by a static_assert.
  *
- * Post-incement and decrement are especially inefficient, as those
- * operations require heap allocation.
+ * Erased iterators which fit in `small_buffer_size` bytes,
+ * are no more strictly aligned than `std::max_align_t`,
+ * and are nothrow move constructible are stored inline,
+ * and copying the wrapper does not allocate.
+ * This covers pointers and the iterators of the standard containers.
+ * Larger erased iterators fall back to heap allocation,
+ * or to a `std::pmr::memory_resource` if one is passed at construction.
+ * Copies propagate the resource, so an arena such as
+ * `std::pmr::monotonic_buffer_resource` can back every copy
+ * and be released all at once.
  *
  * Equality comparison between two of these type erased iterators
  * which are contain iterators of different underlying type is guaranteed
  * to return false and not throw.
+ * The underlying types are told apart without RTTI,
+ * so this works with `-fno-rtti`.
  *
- * This class is wildly inefficient in comparison to raw iterators,
- * as type erasure necessitates heap allocation.
+ * Every operation is still a virtual call,
+ * so this class is considerably slower than raw iterators.
+ * `supl::table_iterator` trades the random access tier and memory resources
+ * for cheaper dispatch of increment, dereference, and comparison.
  * This class would seldom be appropriate, and this was written entirely
  * as an excercise in implementing nontrivial type erasure.
  *
  * If the `supl::iterator` is null, any attempt to access
  * ( operator++(), operator++(int), operator--(), operator--(int),
- *   operator*(), operator->(), operator==(), operator!=() ),
+ *   operator*(), operator->(), operator==(), operator!=(),
+ *   and the random access operations ),
  * will result in throwing a `supl::bad_iterator_access`.
+ * So will subtracting iterators which hold different erased types.
  *
  * @tparam Value_Type Type being iterated over.
  * If non-const, this wrapper behaves as a non-const iterator.
@@ -150,11 +289,44 @@ public:
  *
  * `iterator<int>` is the result of initializing with `std::vector<int>::iterator`
  * `iterator<const int>` is the result of initializing with `std::vector<int>::const_iterator`
+ *
+ * @tparam Category Iterator category tag determining which operations
+ * are erased. Either `std::bidirectional_iterator_tag`,
+ * or `std::random_access_iterator_tag`.
+ * CTAD always deduces `std::bidirectional_iterator_tag`.
  */
 /* }}} */
-template <typename Value_Type>
+template <
+  typename Value_Type, typename Category = std::bidirectional_iterator_tag>
 class iterator
 {
+    static_assert(
+      std::is_base_of_v<std::bidirectional_iterator_tag, Category>,
+      "supl::iterator requires at least a bidirectional category"
+    );
+
+    constexpr inline static bool is_random_access_tier {
+      std::is_base_of_v<std::random_access_iterator_tag, Category>
+    };
+
+    using span_type = std::pair<Value_Type*, Value_Type*>;
+
+public:
+
+    /* {{{ doc */
+    /**
+   * @brief Size of the inline buffer used to store the erased iterator.
+   * Erased iterators which do not fit are heap allocated.
+   *
+   * @details The buffer also holds a vtable pointer,
+   * so four pointers are left for the erased iterator,
+   * which is enough for a `std::deque` iterator.
+   */
+    /* }}} */
+    constexpr inline static std::size_t small_buffer_size {
+      5 * sizeof(void*)
+    };
+
 private:
 
     class Iterator_Concept
@@ -178,19 +350,130 @@ private:
           -> bool = 0;
         virtual auto operator!=(const iterator& rhs) const noexcept
           -> bool = 0;
-        [[nodiscard]] virtual auto iterator_impl_clone() const noexcept
-          -> std::unique_ptr<Iterator_Concept> = 0;
+
+        [[nodiscard]] virtual auto contiguous_span(const iterator& end
+        ) const noexcept -> std::optional<span_type> = 0;
+
+        // May throw if copying an element throws
+        virtual auto next_block(
+          std::remove_const_t<Value_Type>* out, std::size_t max,
+          const iterator& end
+        ) -> std::size_t = 0;
+
+        // Copies the model into `buffer` if it fits,
+        // otherwise into memory from `resource`,
+        // or onto the heap if `resource` is null
+        [[nodiscard]] virtual auto iterator_impl_clone_into(
+          void* buffer, std::pmr::memory_resource* resource
+        ) const noexcept -> Iterator_Concept* = 0;
+
+        // Destroys a model not stored inline,
+        // returning its memory to `resource`, or the heap if null
+        virtual void
+        iterator_impl_deallocate(std::pmr::memory_resource* resource
+        ) noexcept = 0;
+
+        // Only called on models stored inline
+        [[nodiscard]] virtual auto
+        iterator_impl_move_into(void* buffer) noexcept
+          -> Iterator_Concept* = 0;
     };  // Iterator_Concept
 
+    // Operations only erased at the random access tier
+    class Random_Access_Concept : public Iterator_Concept
+    {
+    public:
+
+        Random_Access_Concept() noexcept                             = default;
+        Random_Access_Concept(const Random_Access_Concept&) noexcept = default;
+        Random_Access_Concept(Random_Access_Concept&&) noexcept      = default;
+        auto operator=(const Random_Access_Concept&) noexcept
+          -> Random_Access_Concept& = default;
+        auto operator=(Random_Access_Concept&&) noexcept
+          -> Random_Access_Concept&                 = default;
+        ~Random_Access_Concept() noexcept override = default;
+
+        virtual void advance(std::ptrdiff_t n) noexcept = 0;
+        virtual auto distance_from(const iterator& rhs) const noexcept
+          -> std::ptrdiff_t = 0;
+        virtual auto subscript(std::ptrdiff_t n) noexcept
+          -> Value_Type& = 0;
+        virtual auto less_than(const iterator& rhs) const noexcept
+          -> bool = 0;
+    };  // Random_Access_Concept
+
+    // Concept implemented by models of this tier
+    using tier_concept = std::conditional_t<
+      is_random_access_tier, Random_Access_Concept, Iterator_Concept>;
+
     template <typename Erased_Iterator_Type>
-    class Iterator_Model : public Iterator_Concept
+    class Iterator_Model;
+
+    template <typename Erased_Iterator_Type>
+    class Random_Access_Model;
+
+    // Model erasing `Erased_Iterator_Type` at this tier,
+    // so models of other tiers never declare random access operations
+    template <typename Erased_Iterator_Type>
+    using model_of = std::conditional_t<
+      is_random_access_tier, Random_Access_Model<Erased_Iterator_Type>,
+      Iterator_Model<Erased_Iterator_Type>>;
+
+    // Each erased type gets a distinct address to identify it,
+    // so no RTTI is needed to tell erased types apart.
+    // Not const, as identical read-only objects may be merged
+    // by the linker, giving several types the same address.
+    template <typename Erased_Iterator_Type>
+    struct Type_Tag
     {
-    private:
+        // NOLINTNEXTLINE(*non-const-global*)
+        inline static char id;
+    };
+
+    template <typename Erased_Iterator_Type>
+    constexpr inline static const void* type_tag_of {
+      &Type_Tag<Erased_Iterator_Type>::id
+    };
+
+    template <typename Model>
+    constexpr inline static bool fits_inline {
+      sizeof(Model) <= small_buffer_size
+      && alignof(Model) <= alignof(std::max_align_t)
+      && std::is_nothrow_move_constructible_v<typename Model::erased_type>
+    };
+
+    template <typename Model, typename... Args>
+    [[nodiscard]] static auto p_make_model(
+      void* buffer, std::pmr::memory_resource* resource, Args&&... args
+    ) noexcept -> Iterator_Concept*
+    {
+        if constexpr ( fits_inline<Model> )
+        {
+            static_cast<void>(resource);
+            return ::new (buffer) Model(std::forward<Args>(args)...);
+        }
+        else if ( resource == nullptr )
+        {
+            return new Model(std::forward<Args>(args)...);
+        }
+        else
+        {
+            return ::new (resource->allocate(sizeof(Model), alignof(Model)))
+              Model(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename Erased_Iterator_Type>
+    class Iterator_Model : public tier_concept
+    {
+    protected:
 
         Erased_Iterator_Type m_erased;
 
     public:
 
+        using erased_type = Erased_Iterator_Type;
+
         Iterator_Model() noexcept                      = default;
         Iterator_Model(const Iterator_Model&) noexcept = default;
         Iterator_Model(Iterator_Model&&) noexcept      = default;
@@ -231,14 +514,11 @@ private:
         auto operator==(const iterator& rhs) const noexcept
           -> bool override
         {
-            if ( auto* rhs_cast {
-                   dynamic_cast<Iterator_Model<Erased_Iterator_Type>*>(
-                     rhs.m_value.get()
-                   )
-                 };
-                 rhs_cast != nullptr )
+            if ( rhs.m_type_tag == type_tag_of<Erased_Iterator_Type> )
             {
-                return this->m_erased == rhs_cast->m_erased;
+                return this->m_erased
+                    == static_cast<const Iterator_Model*>(rhs.m_value)
+                         ->m_erased;
             }
             else
             {
@@ -252,60 +532,329 @@ private:
             return ! this->operator==(rhs);
         }
 
-        [[nodiscard]] auto iterator_impl_clone() const noexcept
-          -> std::unique_ptr<Iterator_Concept> override
+        [[nodiscard]] auto contiguous_span(const iterator& end
+        ) const noexcept -> std::optional<span_type> override
+        {
+            if constexpr ( is_contiguous_iterator_v<Erased_Iterator_Type> )
+            {
+                if ( end.m_type_tag != type_tag_of<Erased_Iterator_Type> )
+                {
+                    return std::nullopt;
+                }
+
+                const Erased_Iterator_Type& end_erased {
+                  static_cast<const Iterator_Model*>(end.m_value)->m_erased
+                };
+
+                if ( m_erased == end_erased )
+                {
+                    return span_type {nullptr, nullptr};
+                }
+
+                Value_Type* const first {std::addressof(*m_erased)};
+                return span_type {first, first + (end_erased - m_erased)};
+            }
+            else
+            {
+                static_cast<void>(end);
+                return std::nullopt;
+            }
+        }
+
+        auto next_block(
+          std::remove_const_t<Value_Type>* const out,
+          const std::size_t max, const iterator& end
+        ) -> std::size_t override
+        {
+            using value_type = std::remove_const_t<Value_Type>;
+
+            // The public interface only exposes this
+            // for copy constructible types, so it is unreachable otherwise
+            if constexpr ( std::is_copy_constructible_v<value_type> )
+            {
+                if ( end.m_type_tag != type_tag_of<Erased_Iterator_Type> )
+                {
+                    return 0;
+                }
+
+                const Erased_Iterator_Type& end_erased {
+                  static_cast<const Iterator_Model*>(end.m_value)->m_erased
+                };
+
+                std::size_t count {0};
+                try
+                {
+                    // only equality comparison is required of erased types
+                    for ( ; count != max && ! (m_erased == end_erased);
+                          ++count, ++m_erased )
+                    {
+                        ::new (static_cast<void*>(out + count))
+                          value_type(*m_erased);
+                    }
+                }
+                catch ( ... )
+                {
+                    std::destroy_n(out, count);
+                    throw;
+                }
+                return count;
+            }
+            else
+            {
+                static_cast<void>(out);
+                static_cast<void>(max);
+                static_cast<void>(end);
+                std::terminate();
+            }
+        }
+
+        [[nodiscard]] auto iterator_impl_clone_into(
+          void* buffer, std::pmr::memory_resource* resource
+        ) const noexcept -> Iterator_Concept* override
+        {
+            return p_make_model<model_of<Erased_Iterator_Type>>(
+              buffer, resource, m_erased
+            );
+        }
+
+        void iterator_impl_deallocate(std::pmr::memory_resource* resource
+        ) noexcept override
+        {
+            if ( resource == nullptr )
+            {
+                delete this;
+            }
+            else
+            {
+                using model = model_of<Erased_Iterator_Type>;
+
+                this->~Iterator_Model();
+                resource->deallocate(this, sizeof(model), alignof(model));
+            }
+        }
+
+        [[nodiscard]] auto iterator_impl_move_into(void* buffer) noexcept
+          -> Iterator_Concept* override
         {
-            return std::make_unique<Iterator_Model>(m_erased);
+            // Only called on models stored inline,
+            // so no memory resource is needed
+            return p_make_model<model_of<Erased_Iterator_Type>>(
+              buffer, nullptr, std::move(m_erased)
+            );
         }
     };  // Iterator_Model
 
-    std::unique_ptr<Iterator_Concept> m_value;
+    template <typename Erased_Iterator_Type>
+    class Random_Access_Model : public Iterator_Model<Erased_Iterator_Type>
+    {
+    private:
+
+        using Iterator_Model<Erased_Iterator_Type>::m_erased;
+
+    public:
+
+        using Iterator_Model<Erased_Iterator_Type>::Iterator_Model;
+
+        Random_Access_Model() noexcept                           = default;
+        Random_Access_Model(const Random_Access_Model&) noexcept = default;
+        Random_Access_Model(Random_Access_Model&&) noexcept      = default;
+        auto operator=(const Random_Access_Model&) noexcept
+          -> Random_Access_Model& = default;
+        auto operator=(Random_Access_Model&&) noexcept
+          -> Random_Access_Model&                = default;
+        ~Random_Access_Model() noexcept override = default;
+
+        void advance(const std::ptrdiff_t n) noexcept override
+        {
+            m_erased += n;
+        }
+
+        // `rhs` must hold an `Erased_Iterator_Type`
+        auto distance_from(const iterator& rhs) const noexcept
+          -> std::ptrdiff_t override
+        {
+            return static_cast<std::ptrdiff_t>(
+              m_erased
+              - static_cast<const Random_Access_Model*>(rhs.m_value)->m_erased
+            );
+        }
+
+        auto subscript(const std::ptrdiff_t n) noexcept
+          -> Value_Type& override
+        {
+            return m_erased[n];
+        }
+
+        auto less_than(const iterator& rhs) const noexcept
+          -> bool override
+        {
+            if ( rhs.m_type_tag == type_tag_of<Erased_Iterator_Type> )
+            {
+                return m_erased
+                     < static_cast<const Random_Access_Model*>(rhs.m_value)
+                         ->m_erased;
+            }
+            else
+            {
+                return false;
+            }
+        }
+    };  // Random_Access_Model
+
+    alignas(std::max_align_t) std::array<std::byte, small_buffer_size> m_buffer {};
+    // Declared before `m_value`,
+    // as models are allocated from it during construction
+    std::pmr::memory_resource* m_resource {nullptr};
+    Iterator_Concept* m_value {nullptr};
+    const void* m_type_tag {nullptr};
+
+    // Only called at the random access tier
+    [[nodiscard]] auto p_random_access() const noexcept
+      -> Random_Access_Concept*
+    {
+        return static_cast<Random_Access_Concept*>(m_value);
+    }
 
     void p_throw_if_null() const
     {
-        if ( ! m_value )
+        if ( m_value == nullptr )
         {
             throw bad_iterator_access {};
         }
     }
 
+    [[nodiscard]] auto p_is_inline() const noexcept -> bool
+    {
+        return static_cast<const void*>(m_value)
+            == static_cast<const void*>(m_buffer.data());
+    }
+
+    void p_reset() noexcept
+    {
+        if ( p_is_inline() )
+        {
+            m_value->~Iterator_Concept();
+        }
+        else if ( m_value != nullptr )
+        {
+            m_value->iterator_impl_deallocate(m_resource);
+        }
+        m_value    = nullptr;
+        m_type_tag = nullptr;
+    }
+
+    void p_copy_from(const iterator& src) noexcept
+    {
+        m_resource = src.m_resource;
+        if ( src.m_value != nullptr )
+        {
+            m_value = src.m_value->iterator_impl_clone_into(
+              m_buffer.data(), m_resource
+            );
+            m_type_tag = src.m_type_tag;
+        }
+    }
+
+    void p_move_from(iterator& src) noexcept
+    {
+        m_resource = src.m_resource;
+        if ( src.p_is_inline() )
+        {
+            m_value = src.m_value->iterator_impl_move_into(m_buffer.data());
+            m_type_tag = src.m_type_tag;
+            src.p_reset();
+        }
+        else
+        {
+            m_value        = src.m_value;
+            m_type_tag     = src.m_type_tag;
+            src.m_value    = nullptr;
+            src.m_type_tag = nullptr;
+        }
+    }
+
 public:
 
     using value_type        = std::remove_const_t<Value_Type>;
     using difference_type   = std::ptrdiff_t;
     using pointer           = Value_Type*;
     using reference         = Value_Type&;
-    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_category = Category;
 
     iterator() noexcept = default;
 
     iterator(const iterator& src) noexcept
-            : m_value {src.m_value->iterator_impl_clone()}
     {
+        p_copy_from(src);
     }
 
-    iterator(iterator&&) noexcept = default;
+    iterator(iterator&& src) noexcept
+    {
+        p_move_from(src);
+    }
 
     auto operator=(const iterator& rhs) noexcept -> iterator&
     {
         if ( this != &rhs )
         {
-            m_value = rhs.m_value->iterator_impl_clone();
+            p_reset();
+            p_copy_from(rhs);
+        }
+        return *this;
+    }
+
+    auto operator=(iterator&& rhs) noexcept -> iterator&
+    {
+        if ( this != &rhs )
+        {
+            p_reset();
+            p_move_from(rhs);
         }
         return *this;
     }
 
-    auto operator=(iterator&&) noexcept -> iterator& = default;
-    ~iterator()                                      = default;
+    ~iterator()
+    {
+        p_reset();
+    }
 
     template <
       typename T, typename = std::enable_if_t<
                     ! std::is_same_v<std::decay_t<T>, iterator>>>
     explicit iterator(T&& value) noexcept
-            : m_value(std::make_unique<Iterator_Model<std::decay_t<T>>>(
-                std::forward<T>(value)
-              ))
+            : iterator {std::forward<T>(value), nullptr}
+    {
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Erase `value`, allocating from `resource`
+   * if it does not fit in the inline buffer.
+   *
+   * @details The resource is propagated to copies of this iterator,
+   * and is kept when a new erased iterator is assigned.
+   *
+   * @pre `resource` must outlive this iterator and every copy of it.
+   * If null, the heap is used, as if no resource were passed.
+   * If this precondition is not satisfied, the result is undefined.
+   */
+    /* }}} */
+    template <
+      typename T, typename = std::enable_if_t<
+                    ! std::is_same_v<std::decay_t<T>, iterator>>>
+    iterator(T&& value, std::pmr::memory_resource* const resource) noexcept
+            : m_resource {resource}
+            , m_value {p_make_model<model_of<std::decay_t<T>>>(
+                m_buffer.data(), m_resource, std::forward<T>(value)
+              )}
+            , m_type_tag {type_tag_of<std::decay_t<T>>}
     {
+        static_assert(
+          std::is_base_of_v<
+            Category, typename std::iterator_traits<
+                        std::decay_t<T>>::iterator_category>,
+          "Erased iterator does not satisfy the requested category"
+        );
     }
 
     template <
@@ -336,9 +885,18 @@ public:
           "Can only assign to iterator of the same value type"
         );
 
-        m_value = std::make_unique<Iterator_Model<std::decay_t<T>>>(
-          std::forward<T>(rhs)
+        static_assert(
+          std::is_base_of_v<
+            Category, typename std::iterator_traits<
+                        std::decay_t<T>>::iterator_category>,
+          "Erased iterator does not satisfy the requested category"
+        );
+
+        p_reset();
+        m_value = p_make_model<model_of<std::decay_t<T>>>(
+          m_buffer.data(), m_resource, std::forward<T>(rhs)
         );
+        m_type_tag = type_tag_of<std::decay_t<T>>;
         return *this;
     }
 
@@ -396,23 +954,1602 @@ public:
         return ! this->operator==(rhs);
     }
 
+    ///////////////////////////////////////////// random access tier
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    auto operator+=(const difference_type n) -> iterator&
+    {
+        this->p_throw_if_null();
+        p_random_access()->advance(n);
+        return *this;
+    }
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    auto operator-=(const difference_type n) -> iterator&
+    {
+        this->p_throw_if_null();
+        p_random_access()->advance(-n);
+        return *this;
+    }
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator+(const difference_type n) const -> iterator
+    {
+        iterator tmp {*this};
+        tmp += n;
+        return tmp;
+    }
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] friend auto
+    operator+(const difference_type n, const iterator& itr) -> iterator
+    {
+        return itr + n;
+    }
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator-(const difference_type n) const -> iterator
+    {
+        iterator tmp {*this};
+        tmp -= n;
+        return tmp;
+    }
+
     /* {{{ doc */
     /**
-   * @brief Determine if an iterator is held
+   * @brief Distance between two iterators.
    *
-   * @return True if `iterator` is null, i.e. does not hold
-   * an iterator. False if an iterator is held.
+   * @throws supl::bad_iterator_access If either iterator is null,
+   * or they hold different erased types, as there is no distance
+   * between unrelated iterators.
    */
     /* }}} */
-    [[nodiscard]] auto is_null() const noexcept -> bool
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator-(const iterator& rhs) const
+      -> difference_type
     {
-        return ! m_value;
+        this->p_throw_if_null();
+        rhs.p_throw_if_null();
+
+        if ( m_type_tag != rhs.m_type_tag )
+        {
+            throw bad_iterator_access {};
+        }
+
+        return p_random_access()->distance_from(rhs);
     }
-};
 
-template <typename T>
-iterator(T) -> iterator<
-  std::remove_reference_t<typename std::iterator_traits<T>::reference>>;
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator[](const difference_type n) const
+      -> Value_Type&
+    {
+        this->p_throw_if_null();
+        return p_random_access()->subscript(n);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Relational comparison.
+   * Iterators holding different erased types are unordered,
+   * and all relational comparisons between them return false.
+   */
+    /* }}} */
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator<(const iterator& rhs) const -> bool
+    {
+        this->p_throw_if_null();
+        return p_random_access()->less_than(rhs);
+    }
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator>(const iterator& rhs) const -> bool
+    {
+        this->p_throw_if_null();
+        rhs.p_throw_if_null();
+        return rhs.p_random_access()->less_than(*this);
+    }
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator<=(const iterator& rhs) const -> bool
+    {
+        return *this < rhs || *this == rhs;
+    }
+
+    template <
+      bool Random_Access = is_random_access_tier,
+      typename           = std::enable_if_t<Random_Access>>
+    [[nodiscard]] auto operator>=(const iterator& rhs) const -> bool
+    {
+        return rhs < *this || *this == rhs;
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if an iterator is held
+   *
+   * @return True if `iterator` is null, i.e. does not hold
+   * an iterator. False if an iterator is held.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_null() const noexcept -> bool
+    {
+        return m_value == nullptr;
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if the held iterator is stored in the inline buffer
+   *
+   * @return True if an iterator is held and does not live on the heap.
+   * False if null, or if the held iterator was too large for the buffer.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_small_buffered() const noexcept -> bool
+    {
+        return m_value != nullptr && p_is_inline();
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Memory resource used for erased iterators
+   * which do not fit in the inline buffer.
+   *
+   * @return The resource passed at construction, or propagated
+   * from the iterator this was copied from.
+   * Null if erased iterators are allocated with `new`.
+   */
+    /* }}} */
+    [[nodiscard]] auto resource() const noexcept
+      -> std::pmr::memory_resource*
+    {
+        return m_resource;
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Get the range [*this, end) as a pair of pointers,
+   * if the erased iterator is contiguous.
+   *
+   * @details This allows algorithms to bypass a virtual call per element.
+   * See `supl::is_contiguous_iterator` for which erased iterators
+   * are considered contiguous.
+   *
+   * @pre `end` must be reachable by incrementing `*this`.
+   * If this precondition is not satisfied, the result is undefined.
+   *
+   * @param end End of the range.
+   *
+   * @return Pointers to the beginning and end of the range,
+   * or `std::nullopt` if the erased iterator is not contiguous,
+   * or if `end` holds a different erased type.
+   * An empty range is returned as a pair of null pointers.
+   */
+    /* }}} */
+    [[nodiscard]] auto contiguous_span(const iterator& end) const
+      -> std::optional<span_type>
+    {
+        this->p_throw_if_null();
+        return m_value->contiguous_span(end);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Copy up to `max` elements in a single virtual call,
+   * advancing this iterator past them.
+   *
+   * @details Copying stops early if `end` is reached.
+   * The elements are copy constructed into `out`,
+   * so `out` need not point to constructed objects,
+   * and the caller is responsible for destroying the copies.
+   * `supl::for_each_block` manages this automatically.
+   * If copying an element throws, the copies already made are destroyed,
+   * this iterator is left at the element which failed to copy,
+   * and the exception is propagated.
+   *
+   * @pre `out` must point to storage for at least `max` objects
+   * of type `value_type`, which are not alive.
+   * If this precondition is not satisfied, the result is undefined.
+   *
+   * @pre `end` must be reachable by incrementing `*this`.
+   * If this precondition is not satisfied, the result is undefined.
+   *
+   * @param out Destination of copied elements.
+   *
+   * @param max Maximum number of elements to copy.
+   *
+   * @param end End of the range.
+   *
+   * @return Number of elements copied. Zero if `*this == end`,
+   * or if `end` holds a different erased type.
+   */
+    /* }}} */
+    template <
+      typename Value = value_type,
+      typename = std::enable_if_t<std::is_copy_constructible_v<Value>>>
+    auto next_block(
+      value_type* const out, const std::size_t max, const iterator& end
+    ) -> std::size_t
+    {
+        this->p_throw_if_null();
+        return m_value->next_block(out, max, end);
+    }
+};
+
+/* {{{ doc */
+/**
+ * @brief Determines if `T` is a specialization of `supl::iterator`
+ */
+/* }}} */
+template <typename T>
+struct is_erased_iterator : std::false_type
+{
+};
+
+template <typename Value_Type, typename Category>
+struct is_erased_iterator<iterator<Value_Type, Category>> : std::true_type
+{
+};
+
+template <typename T>
+constexpr inline bool is_erased_iterator_v = is_erased_iterator<T>::value;
+
+template <typename T>
+iterator(T) -> iterator<
+  std::remove_reference_t<typename std::iterator_traits<T>::reference>>;
+
+template <typename T>
+iterator(T, std::pmr::memory_resource*) -> iterator<
+  std::remove_reference_t<typename std::iterator_traits<T>::reference>>;
+
+/* {{{ doc */
+/**
+ * @brief Type erased wrapper for a bidirectional iterator,
+ * implemented with function pointers rather than virtual functions
+ *
+ * @details This should work just like `supl::iterator`
+ * at the bidirectional tier.
+ * Dereference, arrow operator, pre- and post-increment and decrement,
+ * and equality comparison all work as expected.
+ *
+ * Rather than reaching its operations through a model's vtable,
+ * the hot operations, increment, dereference, and equality comparison,
+ * are stored as function pointers directly in the wrapper,
+ * next to the inline buffer holding the erased iterator.
+ * This saves two dependent loads per call.
+ * The remaining operations go through a static table
+ * of function pointers, one per erased type.
+ * The address of that table also identifies the erased type,
+ * so no RTTI is needed.
+ *
+ * Erased iterators which fit in `small_buffer_size` bytes,
+ * are no more strictly aligned than `std::max_align_t`,
+ * and are nothrow move constructible are stored inline,
+ * and copying the wrapper does not allocate.
+ * This covers pointers and the iterators of the standard containers.
+ * Larger erased iterators fall back to heap allocation.
+ *
+ * Equality comparison between two of these type erased iterators
+ * which contain iterators of different underlying type is guaranteed
+ * to return false and not throw.
+ *
+ * If the `supl::table_iterator` is null, any attempt to access
+ * ( operator++(), operator++(int), operator--(), operator--(int),
+ *   operator*(), operator->(), operator==(), operator!=() ),
+ * will result in throwing a `supl::bad_iterator_access`.
+ *
+ * @tparam Value_Type Type being iterated over.
+ * If non-const, this wrapper behaves as a non-const iterator.
+ * If const, this wrapper behaves as a const iterator.
+ * If CTAD is performed, the correct type will be deduced.
+ */
+/* }}} */
+template <typename Value_Type>
+class table_iterator
+{
+public:
+
+    /* {{{ doc */
+    /**
+   * @brief Size of the inline buffer used to store the erased iterator.
+   * Erased iterators which do not fit are heap allocated.
+   *
+   * @details Unlike `supl::iterator`, no vtable pointer is stored
+   * in the buffer, so four pointers fit,
+   * which is enough for a `std::deque` iterator.
+   */
+    /* }}} */
+    constexpr inline static std::size_t small_buffer_size {
+      4 * sizeof(void*)
+    };
+
+private:
+
+    using increment_function   = void (*)(void*) noexcept;
+    using dereference_function = Value_Type& (*)(void*) noexcept;
+    using equal_function = bool (*)(const void*, const void*) noexcept;
+
+    // Operations not stored directly in the wrapper
+    struct Table
+    {
+        increment_function decrement;
+        // Copy constructs into uninitialized storage
+        void (*copy)(void* dest, const void* src) noexcept;
+        // Move constructs into uninitialized storage,
+        // and destroys the source
+        void (*relocate)(void* dest, void* src) noexcept;
+        void (*destroy)(void*) noexcept;
+        bool is_inline;
+    };
+
+    template <typename Erased_Iterator_Type>
+    struct Operations
+    {
+        constexpr inline static bool is_inline {
+          sizeof(Erased_Iterator_Type) <= small_buffer_size
+          && alignof(Erased_Iterator_Type) <= alignof(std::max_align_t)
+          && std::is_nothrow_move_constructible_v<Erased_Iterator_Type>
+        };
+
+        // Inline erased iterators live in the buffer,
+        // otherwise the buffer holds a pointer to the heap
+        [[nodiscard]] static auto get(void* storage) noexcept
+          -> Erased_Iterator_Type&
+        {
+            if constexpr ( is_inline )
+            {
+                return *std::launder(
+                  static_cast<Erased_Iterator_Type*>(storage)
+                );
+            }
+            else
+            {
+                return **std::launder(
+                  static_cast<Erased_Iterator_Type**>(storage)
+                );
+            }
+        }
+
+        [[nodiscard]] static auto get(const void* storage) noexcept
+          -> const Erased_Iterator_Type&
+        {
+            // NOLINTNEXTLINE(*const-cast*)
+            return get(const_cast<void*>(storage));
+        }
+
+        template <typename T>
+        static void construct(void* storage, T&& value) noexcept
+        {
+            if constexpr ( is_inline )
+            {
+                ::new (storage) Erased_Iterator_Type(std::forward<T>(value));
+            }
+            else
+            {
+                ::new (storage) Erased_Iterator_Type*(
+                  new Erased_Iterator_Type(std::forward<T>(value))
+                );
+            }
+        }
+
+        static void increment(void* storage) noexcept
+        {
+            ++get(storage);
+        }
+
+        static void decrement(void* storage) noexcept
+        {
+            --get(storage);
+        }
+
+        [[nodiscard]] static auto dereference(void* storage) noexcept
+          -> Value_Type&
+        {
+            return *get(storage);
+        }
+
+        [[nodiscard]] static auto
+        equal(const void* lhs, const void* rhs) noexcept -> bool
+        {
+            return get(lhs) == get(rhs);
+        }
+
+        static void copy(void* dest, const void* src) noexcept
+        {
+            construct(dest, get(src));
+        }
+
+        static void relocate(void* dest, void* src) noexcept
+        {
+            if constexpr ( is_inline )
+            {
+                construct(dest, std::move(get(src)));
+                destroy(src);
+            }
+            else
+            {
+                // The heap allocation changes owner
+                ::new (dest) Erased_Iterator_Type*(&get(src));
+            }
+        }
+
+        static void destroy(void* storage) noexcept
+        {
+            if constexpr ( is_inline )
+            {
+                get(storage).~Erased_Iterator_Type();
+            }
+            else
+            {
+                delete &get(storage);
+            }
+        }
+
+        constexpr inline static Table table {
+          &decrement, &copy, &relocate, &destroy, is_inline};
+    };
+
+    alignas(std::max_align_t
+    ) mutable std::array<std::byte, small_buffer_size> m_buffer {};
+    const Table* m_table {nullptr};
+    increment_function m_increment {nullptr};
+    dereference_function m_dereference {nullptr};
+    equal_function m_equal {nullptr};
+
+    void p_throw_if_null() const
+    {
+        if ( m_table == nullptr )
+        {
+            throw bad_iterator_access {};
+        }
+    }
+
+    template <typename T>
+    void p_emplace(T&& value) noexcept
+    {
+        using operations = Operations<std::decay_t<T>>;
+
+        operations::construct(m_buffer.data(), std::forward<T>(value));
+        m_table       = &operations::table;
+        m_increment   = &operations::increment;
+        m_dereference = &operations::dereference;
+        m_equal       = &operations::equal;
+    }
+
+    void p_reset() noexcept
+    {
+        if ( m_table != nullptr )
+        {
+            m_table->destroy(m_buffer.data());
+        }
+        m_table       = nullptr;
+        m_increment   = nullptr;
+        m_dereference = nullptr;
+        m_equal       = nullptr;
+    }
+
+    void p_take_functions_from(const table_iterator& src) noexcept
+    {
+        m_table       = src.m_table;
+        m_increment   = src.m_increment;
+        m_dereference = src.m_dereference;
+        m_equal       = src.m_equal;
+    }
+
+    void p_copy_from(const table_iterator& src) noexcept
+    {
+        if ( src.m_table != nullptr )
+        {
+            src.m_table->copy(m_buffer.data(), src.m_buffer.data());
+            p_take_functions_from(src);
+        }
+    }
+
+    void p_move_from(table_iterator& src) noexcept
+    {
+        if ( src.m_table != nullptr )
+        {
+            src.m_table->relocate(m_buffer.data(), src.m_buffer.data());
+            p_take_functions_from(src);
+
+            // Already destroyed by `relocate`
+            src.m_table       = nullptr;
+            src.m_increment   = nullptr;
+            src.m_dereference = nullptr;
+            src.m_equal       = nullptr;
+        }
+    }
+
+public:
+
+    using value_type        = std::remove_const_t<Value_Type>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = Value_Type*;
+    using reference         = Value_Type&;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    table_iterator() noexcept = default;
+
+    table_iterator(const table_iterator& src) noexcept
+    {
+        p_copy_from(src);
+    }
+
+    table_iterator(table_iterator&& src) noexcept
+    {
+        p_move_from(src);
+    }
+
+    auto operator=(const table_iterator& rhs) noexcept -> table_iterator&
+    {
+        if ( this != &rhs )
+        {
+            p_reset();
+            p_copy_from(rhs);
+        }
+        return *this;
+    }
+
+    auto operator=(table_iterator&& rhs) noexcept -> table_iterator&
+    {
+        if ( this != &rhs )
+        {
+            p_reset();
+            p_move_from(rhs);
+        }
+        return *this;
+    }
+
+    ~table_iterator()
+    {
+        p_reset();
+    }
+
+    template <
+      typename T, typename = std::enable_if_t<
+                    ! std::is_same_v<std::decay_t<T>, table_iterator>>>
+    explicit table_iterator(T&& value) noexcept
+    {
+        static_assert(
+          is_bidirectional_v<std::decay_t<T>>,
+          "supl::table_iterator requires a bidirectional iterator"
+        );
+
+        p_emplace(std::forward<T>(value));
+    }
+
+    template <
+      typename T, typename = std::enable_if_t<
+                    ! std::is_same_v<std::decay_t<T>, table_iterator>>>
+    auto operator=(T&& rhs) noexcept -> table_iterator&
+    {
+        // if behaving as non-const iterator,
+        // disallow reassigning to a const iterator
+        static_assert(
+          std::is_const_v<Value_Type>
+            || ! std::is_const_v<std::remove_reference_t<
+              typename std::iterator_traits<std::decay_t<T>>::reference>>,
+          "const iterator cannot be assigned to non-const iterator"
+        );
+
+        // Ensure reassignment is only to an iterator of the same value_type
+        static_assert(
+          std::is_same_v<
+            value_type,
+            typename std::iterator_traits<std::decay_t<T>>::value_type>,
+          "Can only assign to iterator of the same value type"
+        );
+
+        static_assert(
+          is_bidirectional_v<std::decay_t<T>>,
+          "supl::table_iterator requires a bidirectional iterator"
+        );
+
+        p_reset();
+        p_emplace(std::forward<T>(rhs));
+        return *this;
+    }
+
+    auto operator++() -> table_iterator&
+    {
+        this->p_throw_if_null();
+        m_increment(m_buffer.data());
+        return *this;
+    }
+
+    auto operator++(int) -> table_iterator
+    {
+        this->p_throw_if_null();
+        table_iterator tmp = *this;
+        m_increment(m_buffer.data());
+        return tmp;
+    }
+
+    auto operator--() -> table_iterator&
+    {
+        this->p_throw_if_null();
+        m_table->decrement(m_buffer.data());
+        return *this;
+    }
+
+    auto operator--(int) -> table_iterator
+    {
+        this->p_throw_if_null();
+        table_iterator tmp = *this;
+        m_table->decrement(m_buffer.data());
+        return tmp;
+    }
+
+    auto operator*() const -> Value_Type&
+    {
+        this->p_throw_if_null();
+        return m_dereference(m_buffer.data());
+    }
+
+    auto operator->() const -> Value_Type*
+    {
+        this->p_throw_if_null();
+        return std::addressof(m_dereference(m_buffer.data()));
+    }
+
+    auto operator==(const table_iterator& rhs) const -> bool
+    {
+        this->p_throw_if_null();
+        return m_table == rhs.m_table
+            && m_equal(m_buffer.data(), rhs.m_buffer.data());
+    }
+
+    auto operator!=(const table_iterator& rhs) const -> bool
+    {
+        return ! this->operator==(rhs);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if an iterator is held
+   *
+   * @return True if `table_iterator` is null, i.e. does not hold
+   * an iterator. False if an iterator is held.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_null() const noexcept -> bool
+    {
+        return m_table == nullptr;
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if the held iterator is stored in the inline buffer
+   *
+   * @return True if an iterator is held and does not live on the heap.
+   * False if null, or if the held iterator was too large for the buffer.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_small_buffered() const noexcept -> bool
+    {
+        return m_table != nullptr && m_table->is_inline;
+    }
+};
+
+template <typename T>
+table_iterator(T) -> table_iterator<
+  std::remove_reference_t<typename std::iterator_traits<T>::reference>>;
+
+/* {{{ doc */
+/**
+ * @brief Move-only type erased wrapper for a single-pass input iterator
+ *
+ * @details Unlike `supl::iterator`, the erased iterator is never copied,
+ * so input iterators such as `std::istream_iterator`,
+ * and move-only generator-style iterators, may be erased.
+ * Values are produced one at a time,
+ * so a stream may be consumed by algorithms such as `supl::for_each`
+ * in constant memory.
+ *
+ * Dereference, arrow operator, pre-increment,
+ * and equality comparison all work as expected.
+ * Post-increment returns nothing, as the wrapper cannot be copied.
+ * As with any input iterator, only one pass may be made,
+ * and dereferencing is only valid until the next increment.
+ *
+ * Being move-only, this must be moved into algorithms
+ * which take iterators by value, as in
+ * `supl::for_each(std::move(begin), std::move(end), func)`.
+ *
+ * Erased iterators which fit in `small_buffer_size` bytes,
+ * are no more strictly aligned than `std::max_align_t`,
+ * and are nothrow move constructible are stored inline.
+ * Larger erased iterators fall back to heap allocation.
+ *
+ * Equality comparison between two of these type erased iterators
+ * which contain iterators of different underlying type is guaranteed
+ * to return false and not throw.
+ *
+ * If the `supl::input_iterator` is null, any attempt to access
+ * ( operator++(), operator++(int), operator*(), operator->(),
+ *   operator==(), operator!=() ),
+ * will result in throwing a `supl::bad_iterator_access`.
+ *
+ * @tparam Value_Type Type being iterated over.
+ * If CTAD is performed, the correct type will be deduced.
+ * `input_iterator<const int>` is the result of initializing with
+ * `std::istream_iterator<int>`
+ */
+/* }}} */
+template <typename Value_Type>
+class input_iterator
+{
+public:
+
+    /* {{{ doc */
+    /**
+   * @brief Size of the inline buffer used to store the erased iterator.
+   * Erased iterators which do not fit are heap allocated.
+   *
+   * @details The buffer also holds a vtable pointer,
+   * so four pointers are left for the erased iterator,
+   * which is enough for a `std::istream_iterator`
+   * of any fundamental type.
+   */
+    /* }}} */
+    constexpr inline static std::size_t small_buffer_size {
+      5 * sizeof(void*)
+    };
+
+private:
+
+    class Input_Concept
+    {
+    public:
+
+        Input_Concept() noexcept                     = default;
+        Input_Concept(const Input_Concept&) noexcept = default;
+        Input_Concept(Input_Concept&&) noexcept      = default;
+        auto operator=(const Input_Concept&) noexcept
+          -> Input_Concept& = default;
+        auto operator=(Input_Concept&&) noexcept
+          -> Input_Concept&               = default;
+        virtual ~Input_Concept() noexcept = default;
+
+        // Reading the next value may throw
+        virtual void operator++()                         = 0;
+        virtual auto operator*() -> Value_Type&           = 0;
+        virtual auto operator->() noexcept -> Value_Type* = 0;
+        virtual auto operator==(const input_iterator& rhs) const noexcept
+          -> bool = 0;
+
+        // Only called on models stored inline
+        [[nodiscard]] virtual auto input_impl_move_into(void* buffer
+        ) noexcept -> Input_Concept* = 0;
+    };  // Input_Concept
+
+    // See `supl::iterator`
+    template <typename Erased_Iterator_Type>
+    struct Type_Tag
+    {
+        // NOLINTNEXTLINE(*non-const-global*)
+        inline static char id;
+    };
+
+    template <typename Erased_Iterator_Type>
+    constexpr inline static const void* type_tag_of {
+      &Type_Tag<Erased_Iterator_Type>::id
+    };
+
+    template <typename Model>
+    constexpr inline static bool fits_inline {
+      sizeof(Model) <= small_buffer_size
+      && alignof(Model) <= alignof(std::max_align_t)
+      && std::is_nothrow_move_constructible_v<typename Model::erased_type>
+    };
+
+    template <typename Model, typename... Args>
+    [[nodiscard]] static auto
+    p_make_model(void* buffer, Args&&... args) -> Input_Concept*
+    {
+        if constexpr ( fits_inline<Model> )
+        {
+            return ::new (buffer) Model(std::forward<Args>(args)...);
+        }
+        else
+        {
+            return new Model(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename Erased_Iterator_Type>
+    class Input_Model : public Input_Concept
+    {
+    private:
+
+        Erased_Iterator_Type m_erased;
+
+    public:
+
+        using erased_type = Erased_Iterator_Type;
+
+        Input_Model(const Input_Model&)                    = delete;
+        Input_Model(Input_Model&&) noexcept                = default;
+        auto operator=(const Input_Model&) -> Input_Model& = delete;
+        auto operator=(Input_Model&&) noexcept -> Input_Model& = default;
+        ~Input_Model() noexcept override                       = default;
+
+        template <
+          typename Type, typename = std::enable_if_t<
+                           ! std::is_same_v<std::decay_t<Type>, Input_Model>>>
+        explicit Input_Model(Type&& value)
+                : m_erased {std::forward<Type>(value)}
+        {
+        }
+
+        void operator++() override
+        {
+            ++m_erased;
+        }
+
+        auto operator*() -> Value_Type& override
+        {
+            return *m_erased;
+        }
+
+        auto operator->() noexcept -> Value_Type* override
+        {
+            return std::addressof(*m_erased);
+        }
+
+        auto operator==(const input_iterator& rhs) const noexcept
+          -> bool override
+        {
+            if ( rhs.m_type_tag == type_tag_of<Erased_Iterator_Type> )
+            {
+                return this->m_erased
+                    == static_cast<const Input_Model*>(rhs.m_value)
+                         ->m_erased;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        [[nodiscard]] auto input_impl_move_into(void* buffer) noexcept
+          -> Input_Concept* override
+        {
+            return ::new (buffer) Input_Model(std::move(*this));
+        }
+    };  // Input_Model
+
+    alignas(std::max_align_t) std::array<std::byte, small_buffer_size> m_buffer {};
+    Input_Concept* m_value {nullptr};
+    const void* m_type_tag {nullptr};
+
+    void p_throw_if_null() const
+    {
+        if ( m_value == nullptr )
+        {
+            throw bad_iterator_access {};
+        }
+    }
+
+    [[nodiscard]] auto p_is_inline() const noexcept -> bool
+    {
+        return static_cast<const void*>(m_value)
+            == static_cast<const void*>(m_buffer.data());
+    }
+
+    void p_reset() noexcept
+    {
+        if ( p_is_inline() )
+        {
+            m_value->~Input_Concept();
+        }
+        else
+        {
+            delete m_value;
+        }
+        m_value    = nullptr;
+        m_type_tag = nullptr;
+    }
+
+    void p_move_from(input_iterator& src) noexcept
+    {
+        if ( src.p_is_inline() )
+        {
+            m_value    = src.m_value->input_impl_move_into(m_buffer.data());
+            m_type_tag = src.m_type_tag;
+            src.p_reset();
+        }
+        else
+        {
+            m_value        = src.m_value;
+            m_type_tag     = src.m_type_tag;
+            src.m_value    = nullptr;
+            src.m_type_tag = nullptr;
+        }
+    }
+
+public:
+
+    using value_type        = std::remove_const_t<Value_Type>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = Value_Type*;
+    using reference         = Value_Type&;
+    using iterator_category = std::input_iterator_tag;
+
+    input_iterator() noexcept = default;
+
+    input_iterator(const input_iterator&)                    = delete;
+    auto operator=(const input_iterator&) -> input_iterator& = delete;
+
+    input_iterator(input_iterator&& src) noexcept
+    {
+        p_move_from(src);
+    }
+
+    auto operator=(input_iterator&& rhs) noexcept -> input_iterator&
+    {
+        if ( this != &rhs )
+        {
+            p_reset();
+            p_move_from(rhs);
+        }
+        return *this;
+    }
+
+    ~input_iterator()
+    {
+        p_reset();
+    }
+
+    template <
+      typename T, typename = std::enable_if_t<
+                    ! std::is_same_v<std::decay_t<T>, input_iterator>>>
+    explicit input_iterator(T&& value)
+            : m_value {p_make_model<Input_Model<std::decay_t<T>>>(
+              m_buffer.data(), std::forward<T>(value)
+            )}
+            , m_type_tag {type_tag_of<std::decay_t<T>>}
+    {
+        static_assert(
+          std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<
+                                       std::decay_t<T>>::iterator_category>,
+          "supl::input_iterator requires an input iterator"
+        );
+    }
+
+    auto operator++() -> input_iterator&
+    {
+        this->p_throw_if_null();
+        m_value->operator++();
+        return *this;
+    }
+
+    void operator++(int)
+    {
+        this->operator++();
+    }
+
+    auto operator*() const -> Value_Type&
+    {
+        this->p_throw_if_null();
+        return m_value->operator*();
+    }
+
+    auto operator->() const -> Value_Type*
+    {
+        this->p_throw_if_null();
+        return m_value->operator->();
+    }
+
+    auto operator==(const input_iterator& rhs) const -> bool
+    {
+        this->p_throw_if_null();
+        return m_value->operator==(rhs);
+    }
+
+    auto operator!=(const input_iterator& rhs) const -> bool
+    {
+        return ! this->operator==(rhs);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if an iterator is held
+   *
+   * @return True if `input_iterator` is null, i.e. does not hold
+   * an iterator. False if an iterator is held.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_null() const noexcept -> bool
+    {
+        return m_value == nullptr;
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if the held iterator is stored in the inline buffer
+   *
+   * @return True if an iterator is held and does not live on the heap.
+   * False if null, or if the held iterator was too large for the buffer.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_small_buffered() const noexcept -> bool
+    {
+        return m_value != nullptr && p_is_inline();
+    }
+};
+
+template <typename T>
+input_iterator(T) -> input_iterator<
+  std::remove_reference_t<typename std::iterator_traits<T>::reference>>;
+
+namespace impl
+{
+    template <typename T, typename = void>
+    struct has_size_member_function : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct has_size_member_function<
+      T, std::void_t<decltype(std::declval<const T&>().size())>>
+            : std::true_type
+    {
+    };
+}  // namespace impl
+
+template <typename T>
+struct is_any_range;
+
+/* {{{ doc */
+/**
+ * @brief Determines if the iterators of `T` remain valid
+ * after the object they were obtained from is destroyed,
+ * because they do not refer into it.
+ *
+ * @details `std::basic_string_view`, `supl::any_range`,
+ * and the index ranges of `supl::fr` are recognized.
+ * This may be specialized for other such types.
+ * `supl::any_range` may be constructed from rvalues of these types.
+ */
+/* }}} */
+template <typename T>
+struct is_borrowed_range : std::false_type
+{
+};
+
+template <typename Char, typename Traits>
+struct is_borrowed_range<std::basic_string_view<Char, Traits>>
+        : std::true_type
+{
+};
+
+template <typename T>
+constexpr inline bool is_borrowed_range_v = is_borrowed_range<T>::value;
+
+/* {{{ doc */
+/**
+ * @brief Type erased range of bidirectional or random access iterators
+ *
+ * @details Erases a begin/end pair of the same iterator type
+ * as a single object, rather than as two `supl::iterator`s.
+ * The pair is stored in one inline buffer if it fits,
+ * or in a single heap allocation otherwise.
+ * This covers pairs of iterators of any of the standard containers.
+ *
+ * `begin()` and `end()` return `supl::iterator`s,
+ * so this works with `supl::fr` algorithms, `supl::to_stream`,
+ * and anything else which expects an iterable.
+ *
+ * The member function `for_each` runs the loop over the erased
+ * iterators in a single virtual call, calling `func` through
+ * a function pointer for each element,
+ * rather than several virtual calls per element.
+ * `supl::fr::for_each`, `supl::fr::count`, and `supl::fr::count_if`
+ * use it automatically.
+ *
+ * If the size of the range is known in constant time at construction,
+ * either because the iterators are random access, or the iterable
+ * has a `size` member function, it is stored,
+ * and `size()` returns it without a virtual call.
+ *
+ * This does not own the elements of the range.
+ * Anything the erased iterators refer to must outlive this object.
+ * To help with this, it may only be constructed from an rvalue iterable
+ * if `supl::is_borrowed_range` is true for it.
+ *
+ * If the `supl::any_range` is null, any attempt to access
+ * ( begin(), end(), empty(), for_each() ),
+ * will result in throwing a `supl::bad_iterator_access`.
+ *
+ * @tparam Value_Type Type being iterated over.
+ * If const, the elements of the range may not be modified.
+ * If CTAD is performed, the correct type will be deduced.
+ */
+/* }}} */
+template <typename Value_Type>
+class any_range
+{
+public:
+
+    /* {{{ doc */
+    /**
+   * @brief Size of the inline buffer used to store the erased iterators.
+   * Erased iterators which do not fit are heap allocated.
+   *
+   * @details The buffer also holds a vtable pointer,
+   * so eight pointers are left for the pair of erased iterators,
+   * which is enough for a pair of `std::deque` iterators.
+   */
+    /* }}} */
+    constexpr inline static std::size_t small_buffer_size {
+      9 * sizeof(void*)
+    };
+
+private:
+
+    using element_func = void (*)(void*, Value_Type&);
+
+    class Range_Concept
+    {
+    public:
+
+        Range_Concept() noexcept                     = default;
+        Range_Concept(const Range_Concept&) noexcept = default;
+        Range_Concept(Range_Concept&&) noexcept      = default;
+        auto operator=(const Range_Concept&) noexcept
+          -> Range_Concept& = default;
+        auto operator=(Range_Concept&&) noexcept
+          -> Range_Concept&               = default;
+        virtual ~Range_Concept() noexcept = default;
+
+        [[nodiscard]] virtual auto begin() const noexcept
+          -> ::supl::iterator<Value_Type> = 0;
+        [[nodiscard]] virtual auto end() const noexcept
+          -> ::supl::iterator<Value_Type> = 0;
+
+        // Calls `call(func, element)` for each element
+        virtual void for_each(void* func, element_func call) const = 0;
+
+        // Copies the model into `buffer` if it fits,
+        // otherwise onto the heap
+        [[nodiscard]] virtual auto range_impl_clone_into(void* buffer
+        ) const noexcept -> Range_Concept* = 0;
+
+        // Only called on models stored inline
+        [[nodiscard]] virtual auto range_impl_move_into(void* buffer
+        ) noexcept -> Range_Concept* = 0;
+    };  // Range_Concept
+
+    template <typename Model>
+    constexpr inline static bool fits_inline {
+      sizeof(Model) <= small_buffer_size
+      && alignof(Model) <= alignof(std::max_align_t)
+      && std::is_nothrow_move_constructible_v<typename Model::erased_type>
+    };
+
+    template <typename Model, typename... Args>
+    [[nodiscard]] static auto
+    p_make_model(void* buffer, Args&&... args) noexcept -> Range_Concept*
+    {
+        if constexpr ( fits_inline<Model> )
+        {
+            return ::new (buffer) Model(std::forward<Args>(args)...);
+        }
+        else
+        {
+            return new Model(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename Erased_Iterator_Type>
+    class Range_Model : public Range_Concept
+    {
+    private:
+
+        Erased_Iterator_Type m_begin;
+        Erased_Iterator_Type m_end;
+
+    public:
+
+        using erased_type = Erased_Iterator_Type;
+
+        Range_Model(const Range_Model&) noexcept = default;
+        Range_Model(Range_Model&&) noexcept      = default;
+        auto operator=(const Range_Model&) noexcept
+          -> Range_Model& = default;
+        auto operator=(Range_Model&&) noexcept
+          -> Range_Model&                = default;
+        ~Range_Model() noexcept override = default;
+
+        Range_Model(
+          Erased_Iterator_Type begin, Erased_Iterator_Type end
+        ) noexcept
+                : m_begin {std::move(begin)}
+                , m_end {std::move(end)}
+        {
+        }
+
+        [[nodiscard]] auto begin() const noexcept
+          -> ::supl::iterator<Value_Type> override
+        {
+            return ::supl::iterator<Value_Type> {m_begin};
+        }
+
+        [[nodiscard]] auto end() const noexcept
+          -> ::supl::iterator<Value_Type> override
+        {
+            return ::supl::iterator<Value_Type> {m_end};
+        }
+
+        void for_each(void* const func, const element_func call)
+          const override
+        {
+            for ( Erased_Iterator_Type itr {m_begin}; itr != m_end; ++itr )
+            {
+                call(func, *itr);
+            }
+        }
+
+        [[nodiscard]] auto range_impl_clone_into(void* buffer
+        ) const noexcept -> Range_Concept* override
+        {
+            return p_make_model<Range_Model>(buffer, m_begin, m_end);
+        }
+
+        [[nodiscard]] auto range_impl_move_into(void* buffer) noexcept
+          -> Range_Concept* override
+        {
+            return p_make_model<Range_Model>(
+              buffer, std::move(m_begin), std::move(m_end)
+            );
+        }
+    };  // Range_Model
+
+    alignas(std::max_align_t) std::array<std::byte, small_buffer_size> m_buffer {};
+    Range_Concept* m_value {nullptr};
+    std::optional<std::size_t> m_size {};
+
+    template <typename Func>
+    static void p_call(void* const func, Value_Type& value)
+    {
+        (*static_cast<Func*>(func))(value);
+    }
+
+    template <typename Itr>
+    static void p_check_erasable() noexcept
+    {
+        static_assert(
+          is_bidirectional_v<Itr>,
+          "supl::any_range requires at least bidirectional iterators"
+        );
+
+        static_assert(
+          std::is_convertible_v<
+            std::remove_reference_t<
+              typename std::iterator_traits<Itr>::reference>*,
+            Value_Type*>,
+          "Erased iterators must refer to elements of type Value_Type"
+        );
+    }
+
+    void p_throw_if_null() const
+    {
+        if ( m_value == nullptr )
+        {
+            throw bad_iterator_access {};
+        }
+    }
+
+    [[nodiscard]] auto p_is_inline() const noexcept -> bool
+    {
+        return static_cast<const void*>(m_value)
+            == static_cast<const void*>(m_buffer.data());
+    }
+
+    void p_reset() noexcept
+    {
+        if ( p_is_inline() )
+        {
+            m_value->~Range_Concept();
+        }
+        else
+        {
+            delete m_value;
+        }
+        m_value = nullptr;
+        m_size.reset();
+    }
+
+    void p_copy_from(const any_range& src) noexcept
+    {
+        if ( src.m_value != nullptr )
+        {
+            m_value = src.m_value->range_impl_clone_into(m_buffer.data());
+            m_size  = src.m_size;
+        }
+    }
+
+    void p_move_from(any_range& src) noexcept
+    {
+        if ( src.p_is_inline() )
+        {
+            m_value = src.m_value->range_impl_move_into(m_buffer.data());
+            m_size  = src.m_size;
+            src.p_reset();
+        }
+        else
+        {
+            m_value     = src.m_value;
+            m_size      = src.m_size;
+            src.m_value = nullptr;
+            src.m_size.reset();
+        }
+    }
+
+public:
+
+    using value_type     = std::remove_const_t<Value_Type>;
+    using iterator       = ::supl::iterator<Value_Type>;
+    using const_iterator = iterator;
+
+    any_range() noexcept = default;
+
+    any_range(const any_range& src) noexcept
+    {
+        p_copy_from(src);
+    }
+
+    any_range(any_range&& src) noexcept
+    {
+        p_move_from(src);
+    }
+
+    auto operator=(const any_range& rhs) noexcept -> any_range&
+    {
+        if ( this != &rhs )
+        {
+            p_reset();
+            p_copy_from(rhs);
+        }
+        return *this;
+    }
+
+    auto operator=(any_range&& rhs) noexcept -> any_range&
+    {
+        if ( this != &rhs )
+        {
+            p_reset();
+            p_move_from(rhs);
+        }
+        return *this;
+    }
+
+    ~any_range()
+    {
+        p_reset();
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Erase the range [begin, end).
+   *
+   * @pre `end` must be reachable by incrementing `begin`.
+   * If this precondition is not satisfied, the result is undefined.
+   */
+    /* }}} */
+    template <typename Itr>
+    any_range(Itr begin, Itr end) noexcept
+    {
+        p_check_erasable<Itr>();
+
+        if constexpr ( is_random_access_v<Itr> )
+        {
+            m_size = static_cast<std::size_t>(std::distance(begin, end));
+        }
+
+        m_value = p_make_model<Range_Model<Itr>>(
+          m_buffer.data(), std::move(begin), std::move(end)
+        );
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Erase the range [std::begin(iterable), std::end(iterable)).
+   *
+   * @details Implicit, so that functions taking a `supl::any_range`
+   * can be called with containers directly.
+   * `iterable` must be an lvalue, unless `supl::is_borrowed_range`
+   * is true for it, as the range would otherwise dangle.
+   */
+    /* }}} */
+    template <
+      typename Iterable,
+      typename = std::enable_if_t<
+        ! std::is_same_v<remove_cvref_t<Iterable>, any_range>
+        && is_iterable_v<std::remove_reference_t<Iterable>>
+        && (std::is_lvalue_reference_v<Iterable>
+            || is_borrowed_range_v<remove_cvref_t<Iterable>>)>,
+      typename = void>
+    // NOLINTNEXTLINE(*explicit*)
+    any_range(Iterable&& iterable) noexcept
+            : any_range {std::begin(iterable), std::end(iterable)}
+    {
+        // Converting from another `supl::any_range`
+        if constexpr ( is_any_range<remove_cvref_t<Iterable>>::value )
+        {
+            m_size = iterable.size();
+        }
+        else if constexpr ( impl::has_size_member_function<
+                              std::remove_reference_t<Iterable>>::value )
+        {
+            m_size = static_cast<std::size_t>(iterable.size());
+        }
+    }
+
+    // The elements of a temporary container
+    // would be destroyed with it, leaving the range dangling
+    template <
+      typename Iterable,
+      typename = std::enable_if_t<
+        ! std::is_same_v<remove_cvref_t<Iterable>, any_range>
+        && is_iterable_v<std::remove_reference_t<Iterable>>
+        && ! std::is_lvalue_reference_v<Iterable>
+        && ! is_borrowed_range_v<remove_cvref_t<Iterable>>>>
+    any_range(Iterable&& iterable) = delete;
+
+    [[nodiscard]] auto begin() const -> iterator
+    {
+        this->p_throw_if_null();
+        return m_value->begin();
+    }
+
+    [[nodiscard]] auto end() const -> iterator
+    {
+        this->p_throw_if_null();
+        return m_value->end();
+    }
+
+    [[nodiscard]] auto cbegin() const -> iterator
+    {
+        return this->begin();
+    }
+
+    [[nodiscard]] auto cend() const -> iterator
+    {
+        return this->end();
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Number of elements in the range, if known in constant time.
+   *
+   * @return The size of the range, or `std::nullopt` if it was not known
+   * at construction. Also `std::nullopt` if null.
+   */
+    /* }}} */
+    [[nodiscard]] auto size() const noexcept -> std::optional<std::size_t>
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] auto empty() const -> bool
+    {
+        if ( m_size.has_value() )
+        {
+            return *m_size == 0;
+        }
+
+        this->p_throw_if_null();
+        return m_value->begin() == m_value->end();
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Applies `func` to each element of the range, in order,
+   * in a single virtual call.
+   *
+   * @tparam Func Callable accepting a `Value_Type&`.
+   *
+   * @param func Callable to apply to each element.
+   *
+   * @return `func`
+   */
+    /* }}} */
+    template <typename Func>
+    auto for_each(Func&& func) const -> Func
+    {
+        this->p_throw_if_null();
+
+        using func_type = std::remove_reference_t<Func>;
+
+        m_value->for_each(
+          const_cast<void*>(  // NOLINT(*const-cast*)
+            static_cast<const void*>(std::addressof(func))
+          ),
+          &p_call<func_type>
+        );
+
+        return std::forward<Func>(func);
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if a range is held
+   *
+   * @return True if `any_range` is null, i.e. does not hold a range.
+   * False if a range is held.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_null() const noexcept -> bool
+    {
+        return m_value == nullptr;
+    }
+
+    /* {{{ doc */
+    /**
+   * @brief Determine if the held range is stored in the inline buffer
+   *
+   * @return True if a range is held and does not live on the heap.
+   * False if null, or if the held range was too large for the buffer.
+   */
+    /* }}} */
+    [[nodiscard]] auto is_small_buffered() const noexcept -> bool
+    {
+        return m_value != nullptr && p_is_inline();
+    }
+};
+
+/* {{{ doc */
+/**
+ * @brief Determines if `T` is a specialization of `supl::any_range`
+ */
+/* }}} */
+template <typename T>
+struct is_any_range : std::false_type
+{
+};
+
+template <typename Value_Type>
+struct is_any_range<any_range<Value_Type>> : std::true_type
+{
+};
+
+template <typename Value_Type>
+struct is_borrowed_range<any_range<Value_Type>> : std::true_type
+{
+};
+
+template <typename T>
+constexpr inline bool is_any_range_v = is_any_range<T>::value;
+
+template <typename Itr>
+any_range(Itr, Itr) -> any_range<
+  std::remove_reference_t<typename std::iterator_traits<Itr>::reference>>;
+
+template <typename Iterable>
+any_range(Iterable&&) -> any_range<std::remove_reference_t<
+  decltype(*std::begin(std::declval<Iterable&>()))>>;
 
 }  // namespace supl
 
@@ -19,6 +19,7 @@
 #define SUPPLE_CORE_PREDICATES_HPP
 
 #include <algorithm>
+#include <functional>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -54,11 +55,82 @@ public:
     ~predicate()                                                 = default;
 
     using Pred::operator();
+
+    /* {{{ doc */
+    /**
+   * @brief Access the wrapped predicate
+   */
+    /* }}} */
+    [[nodiscard]] constexpr auto base() const noexcept -> const Pred&
+    {
+        return *this;
+    }
 };
 
 template <typename T>
 predicate(T) -> predicate<T>;
 
+namespace impl
+{
+    // The predicates below are named types rather than lambdas
+    // so algorithms can recognise them and their operands,
+    // e.g. to compare a vector register's worth of elements at a time
+
+    template <typename T>
+    struct equal_to_pred
+    {
+        T arg;
+
+        template <typename U>
+        [[nodiscard]] constexpr auto operator()(const U& new_arg
+        ) const noexcept -> bool
+        {
+            // `std::equal_to` as `T` may be floating point
+            return std::equal_to<> {}(new_arg, arg);
+        }
+    };
+
+    template <typename T>
+    struct greater_than_pred
+    {
+        T arg;
+
+        template <typename U>
+        [[nodiscard]] constexpr auto operator()(const U& new_arg
+        ) const noexcept -> bool
+        {
+            return new_arg > arg;
+        }
+    };
+
+    template <typename T>
+    struct less_than_pred
+    {
+        T arg;
+
+        template <typename U>
+        [[nodiscard]] constexpr auto operator()(const U& new_arg
+        ) const noexcept -> bool
+        {
+            return new_arg < arg;
+        }
+    };
+
+    template <typename T>
+    struct between_pred
+    {
+        T lower_bound;
+        T upper_bound;
+
+        template <typename U>
+        [[nodiscard]] constexpr auto operator()(const U& new_arg
+        ) const noexcept -> bool
+        {
+            return lower_bound <= new_arg && new_arg <= upper_bound;
+        }
+    };
+}  // namespace impl
+
 constexpr inline auto true_pred {predicate {[](const auto&)
                                             {
                                                 return true;
@@ -86,11 +158,7 @@ template <typename T>
 [[nodiscard]] constexpr auto equal_to(T&& arg) noexcept
 {
     return predicate {
-      [parent_arg = std::forward<T>(arg)](const auto& new_arg
-      ) constexpr noexcept -> bool
-      {
-          return new_arg == parent_arg;
-      }
+      impl::equal_to_pred<std::decay_t<T>> {std::forward<T>(arg)}
     };
 }
 
@@ -173,11 +241,7 @@ template <typename T>
 [[nodiscard]] constexpr auto greater_than(T&& arg) noexcept
 {
     return predicate {
-      [parent_arg = std::forward<T>(arg)](const auto& new_arg
-      ) constexpr noexcept -> bool
-      {
-          return new_arg > parent_arg;
-      }
+      impl::greater_than_pred<std::decay_t<T>> {std::forward<T>(arg)}
     };
 }
 
@@ -223,11 +287,7 @@ template <typename T>
 [[nodiscard]] constexpr auto less_than(T&& arg) noexcept
 {
     return predicate {
-      [parent_arg = std::forward<T>(arg)](const auto& new_arg
-      ) constexpr noexcept -> bool
-      {
-          return new_arg < parent_arg;
-      }
+      impl::less_than_pred<std::decay_t<T>> {std::forward<T>(arg)}
     };
 }
 
@@ -269,14 +329,11 @@ template <typename T>
 template <typename T, typename U>
 [[nodiscard]] constexpr auto between(T&& bound1, U&& bound2) noexcept
 {
-    return predicate {
-      [lower_bound {std::min(bound1, bound2)},
-       upper_bound {std::max(bound1, bound2)}](const auto& new_arg
-      ) constexpr noexcept -> bool
-      {
-          return lower_bound <= new_arg && new_arg <= upper_bound;
-      }
-    };
+    using bound_type = std::decay_t<decltype(std::min(bound1, bound2))>;
+
+    return predicate {impl::between_pred<bound_type> {
+      std::min(bound1, bound2), std::max(bound1, bound2)
+    }};
 }
 
 /* {{{ doc */
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -665,6 +666,76 @@ public:
 
 ///////////////////////////////////////////// end to_stream and related
 
+/* {{{ doc */
+/**
+ * @brief Counter-based random bit generator, built on SplitMix64.
+ *
+ * @details Each `(seed, stream)` pair selects its own sequence,
+ * and constructing a generator is cheap.
+ * A parallel algorithm can therefore give each element its own generator,
+ * using the element's index as the stream,
+ * and produce the same output however its work is divided.
+ *
+ * Satisfies the requirements of UniformRandomBitGenerator,
+ * so may be used with the distributions in `<random>`.
+ * Not suitable for cryptographic use.
+ */
+/* }}} */
+class counter_rng
+{
+public:
+
+    using result_type = std::uint64_t;
+
+private:
+
+    static constexpr result_type golden_gamma {0x9E3779B97F4A7C15};
+
+    result_type m_state;
+
+    // SplitMix64 finalizer
+    [[nodiscard]] static constexpr auto mix(result_type value) noexcept
+      -> result_type
+    {
+        value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27U)) * 0x94D049BB133111EB;
+        return value ^ (value >> 31U);
+    }
+
+public:
+
+    /* {{{ doc */
+    /**
+   * @param seed Seed shared by every generator in a computation
+   *
+   * @param stream Identifies this generator's sequence,
+   * such as the index of the element it is used for
+   */
+    /* }}} */
+    constexpr explicit counter_rng(
+      const result_type seed, const result_type stream = 0
+    ) noexcept
+            : m_state {mix(mix(seed) + stream * golden_gamma)}
+    {
+    }
+
+    constexpr auto operator()() noexcept -> result_type
+    {
+        m_state += golden_gamma;
+        return mix(m_state);
+    }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+};
+
 inline namespace literals
 {
 
@@ -0,0 +1,120 @@
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+
+// Places `needle` at every position of ranges of every length up to 70,
+// so full vectors, partial tails, and both together are covered
+template <typename T>
+static void test_every_position(
+  supl::test_results& results, const std::string& type, const T filler,
+  const T needle
+)
+{
+    bool correct {true};
+
+    for ( std::size_t size {0}; size != 70; ++size )
+    {
+        std::vector<T> haystack(size, filler);
+
+        correct = correct
+               && ! supl::contains(haystack.cbegin(), haystack.cend(), needle);
+
+        for ( std::size_t position {0}; position != size; ++position )
+        {
+            haystack[position] = needle;
+            correct = correct
+                   && supl::contains(
+                        haystack.cbegin(), haystack.cend(), needle
+                   );
+            haystack[position] = filler;
+        }
+
+        // a hit just past the end must not be seen
+        haystack.push_back(needle);
+        correct = correct
+               && ! supl::contains(
+                    haystack.cbegin(), std::prev(haystack.cend()), needle
+               );
+    }
+
+    results.enforce_true(correct, type);
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_every_position<std::int8_t>(results, "int8_t", 1, -1);
+    test_every_position<std::uint8_t>(results, "uint8_t", 0, 0xFF);
+    test_every_position<char>(results, "char", 'a', 'z');
+    test_every_position<std::int16_t>(results, "int16_t", 7, -300);
+    test_every_position<std::uint16_t>(results, "uint16_t", 0, 0xFFFF);
+    test_every_position<int>(results, "int", 42, -42);
+    test_every_position<unsigned>(results, "unsigned", 0, 0x80000000);
+    test_every_position<long long>(results, "long long", 0, 1LL << 40);
+    test_every_position<std::uint64_t>(
+      results, "uint64_t", 0xFFFFFFFF, 0xFFFFFFFF00000000
+    );
+    test_every_position<float>(results, "float", 1.5F, -2.25F);
+    test_every_position<double>(results, "double", 1.5, 1e300);
+
+    {
+        // only half of a 64-bit lane matches
+        const std::vector<std::uint64_t> test_input(
+          17, 0x0000000100000002
+        );
+        results.enforce_false(
+          supl::contains(
+            test_input.cbegin(), test_input.cend(),
+            std::uint64_t {0x0000000300000002}
+          ),
+          "Low half matches, high half does not"
+        );
+    }
+
+    {
+        const std::vector<double> test_input(33, 0.0);
+        results.enforce_true(
+          supl::contains(test_input.cbegin(), test_input.cend(), -0.0),
+          "Negative zero compares equal to zero"
+        );
+    }
+
+    {
+        const std::vector<float> test_input(
+          33, std::numeric_limits<float>::quiet_NaN()
+        );
+        results.enforce_false(
+          supl::contains(
+            test_input.cbegin(), test_input.cend(),
+            std::numeric_limits<float>::quiet_NaN()
+          ),
+          "NaN compares unequal to NaN"
+        );
+    }
+
+    {
+        const std::vector<int> test_input(40, 3);
+        results.enforce_true(
+          supl::contains(test_input.data(), test_input.data() + 40, 3),
+          "Pointers"
+        );
+    }
+
+    {
+        constexpr std::array test_input {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        static_assert(
+          supl::contains(test_input.begin(), test_input.end(), 9)
+        );
+        static_assert(
+          ! supl::contains(test_input.begin(), test_input.end(), 11)
+        );
+    }
+
+    return results.print_and_return();
+}
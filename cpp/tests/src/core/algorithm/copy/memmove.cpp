@@ -0,0 +1,130 @@
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+
+struct trivial
+{
+    int first;
+    double second;
+
+    auto operator==(const trivial& rhs) const noexcept -> bool
+    {
+        return first == rhs.first
+            && std::equal_to<> {}(second, rhs.second);
+    }
+};
+
+auto operator<<(std::ostream& out, const trivial& value) -> std::ostream&
+{
+    return out << value.first << ':' << value.second;
+}
+
+static_assert(supl::impl::is_memmove_copyable_v<int*, int*>);
+static_assert(supl::impl::is_memmove_copyable_v<
+              std::vector<int>::const_iterator, std::vector<int>::iterator>);
+static_assert(! supl::impl::is_memmove_copyable_v<
+              std::vector<int>::iterator, std::vector<int>::const_iterator>);
+static_assert(! supl::impl::is_memmove_copyable_v<int*, long*>);
+static_assert(! supl::impl::is_memmove_copyable_v<
+              std::string*, std::string*>);
+static_assert(! supl::impl::is_memmove_copyable_v<
+              std::vector<int>::iterator,
+              std::back_insert_iterator<std::vector<int>>>);
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    {
+        std::vector<int> test_input(1000);
+        std::iota(test_input.begin(), test_input.end(), 0);
+        std::vector<int> test_output(1000);
+
+        const auto copy_end {supl::copy(
+          test_input.cbegin(), test_input.cend(), test_output.begin()
+        )};
+
+        results.enforce_exactly_equal(test_output, test_input, "copy");
+        results.enforce_true(
+          copy_end == test_output.end(), "copy returned iterator"
+        );
+
+        std::vector<int> test_output_n(1000, -1);
+        const auto copy_n_end {
+          supl::copy_n(test_input.cbegin(), 600, test_output_n.begin())};
+
+        results.enforce_exactly_equal(
+          test_output_n[599], 599, "copy_n last copied"
+        );
+        results.enforce_exactly_equal(
+          test_output_n[600], -1, "copy_n first untouched"
+        );
+        results.enforce_true(
+          copy_n_end == std::next(test_output_n.begin(), 600),
+          "copy_n returned iterator"
+        );
+    }
+
+    {
+        const std::vector<trivial> test_input {
+          {1, 1.5},
+          {2, 2.5},
+          {3, 3.5}
+        };
+        std::vector<trivial> test_output(3);
+
+        supl::copy(test_input.data(), test_input.data() + 3, test_output.data());
+
+        results.enforce_exactly_equal(
+          test_output, test_input, "Trivially copyable class"
+        );
+    }
+
+    {
+        // overlapping, shifting towards the front
+        std::vector<int> test_buffer {0, 1, 2, 3, 4, 5, 6, 7};
+        const std::vector<int> expected {2, 3, 4, 5, 6, 7, 6, 7};
+
+        supl::copy(
+          std::next(test_buffer.begin(), 2), test_buffer.end(),
+          test_buffer.begin()
+        );
+
+        results.enforce_exactly_equal(
+          test_buffer, expected, "Overlapping ranges"
+        );
+    }
+
+    {
+        std::vector<int> empty_input {};
+        std::vector<int> empty_output {};
+
+        results.enforce_true(
+          supl::copy(empty_input.begin(), empty_input.end(), empty_output.begin())
+            == empty_output.begin(),
+          "Empty copy"
+        );
+        results.enforce_true(
+          supl::copy_n(empty_input.begin(), 0, empty_output.begin())
+            == empty_output.begin(),
+          "Empty copy_n"
+        );
+    }
+
+    {
+        // not trivially copyable, so copied element by element
+        const std::vector<std::string> test_input {"a", "bb", "ccc"};
+        std::vector<std::string> test_output(3);
+
+        supl::copy(test_input.cbegin(), test_input.cend(), test_output.begin());
+
+        results.enforce_exactly_equal(
+          test_output, test_input, "Non-trivial type"
+        );
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,199 @@
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+// Records the concatenation of all blocks, and the size of each block
+template <typename T>
+struct block_recorder
+{
+    std::vector<T>* elements;
+    std::vector<std::size_t>* sizes;
+
+    void operator()(const T* data, const std::size_t count) const
+    {
+        elements->insert(elements->end(), data, data + count);
+        sizes->push_back(count);
+    }
+};
+
+template <typename Itr>
+static void enforce_blocks(
+  supl::test_results& results, Itr begin, Itr end,
+  const std::vector<int>& expected, const char* message
+)
+{
+    std::vector<int> elements;
+    std::vector<std::size_t> sizes;
+
+    supl::for_each_block<4>(
+      begin, end, block_recorder<int> {&elements, &sizes}
+    );
+
+    results.enforce_equal(elements, expected, message);
+
+    std::vector<std::size_t> expected_sizes(expected.size() / 4, 4);
+    if ( expected.size() % 4 != 0 )
+    {
+        expected_sizes.push_back(expected.size() % 4);
+    }
+    results.enforce_equal(sizes, expected_sizes, message);
+}
+
+// Tracks how many copies are alive, and throws on the nth copy
+struct throwing_copy
+{
+    inline static int live {0};
+    inline static int copies_until_throw {-1};
+
+    throwing_copy() noexcept
+    {
+        ++live;
+    }
+
+    throwing_copy(const throwing_copy& /*unused*/)
+    {
+        if ( copies_until_throw-- == 0 )
+        {
+            throw std::runtime_error {"copy"};
+        }
+        ++live;
+    }
+
+    throwing_copy(throwing_copy&&)                         = delete;
+    auto operator=(const throwing_copy&) -> throwing_copy& = delete;
+    auto operator=(throwing_copy&&) -> throwing_copy&      = delete;
+
+    ~throwing_copy()
+    {
+        --live;
+    }
+};
+
+// A copy throwing partway through a block must not leak the copies
+// already in that block
+template <typename Itr>
+static void enforce_no_leak(
+  supl::test_results& results, Itr begin, Itr end, const char* message
+)
+{
+    const int live_before {throwing_copy::live};
+    throwing_copy::copies_until_throw = 6;
+
+    bool threw {false};
+    try
+    {
+        supl::for_each_block<4>(
+          begin, end, [](const throwing_copy*, std::size_t) {}
+        );
+    }
+    catch ( const std::runtime_error& )
+    {
+        threw = true;
+    }
+
+    throwing_copy::copies_until_throw = -1;
+    results.enforce_exactly_equal(threw, true, message);
+    results.enforce_exactly_equal(throwing_copy::live, live_before, message);
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    const std::vector<int> vec {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    const std::deque<int> deque(vec.begin(), vec.end());
+    const std::list<int> list(vec.begin(), vec.end());
+    const std::vector<int> exact {1, 2, 3, 4, 5, 6, 7, 8};
+    const std::vector<int> empty {};
+
+    enforce_blocks(results, vec.begin(), vec.end(), vec, "vector");
+    enforce_blocks(results, deque.begin(), deque.end(), vec, "deque");
+    enforce_blocks(results, list.begin(), list.end(), vec, "list");
+    enforce_blocks(results, exact.begin(), exact.end(), exact, "exact");
+    enforce_blocks(results, empty.begin(), empty.end(), empty, "empty");
+
+    enforce_blocks(
+      results, supl::iterator {vec.begin()}, supl::iterator {vec.end()},
+      vec, "erased vector"
+    );
+    enforce_blocks(
+      results, supl::iterator {list.begin()}, supl::iterator {list.end()},
+      vec, "erased list"
+    );
+    enforce_blocks(
+      results, supl::iterator {empty.begin()},
+      supl::iterator {empty.end()}, empty, "erased empty"
+    );
+
+    // contiguous blocks point into the range
+    const int* first_block {nullptr};
+    supl::for_each_block(
+      supl::iterator {vec.begin()}, supl::iterator {vec.end()},
+      [&first_block](const int* data, std::size_t)
+      {
+          if ( first_block == nullptr )
+          {
+              first_block = data;
+          }
+      }
+    );
+    results.enforce_exactly_equal(first_block, vec.data());
+
+    // value type which is neither default constructible nor assignable
+    const std::map<int, int> map {
+      {1, 10},
+      {2, 20},
+      {3, 30}
+    };
+    int key_sum {0};
+    int mapped_sum {0};
+    supl::for_each_block<2>(
+      supl::iterator {map.begin()}, supl::iterator {map.end()},
+      [&key_sum, &mapped_sum](
+        const std::pair<const int, int>* data, const std::size_t count
+      )
+      {
+          for ( std::size_t i {0}; i != count; ++i )
+          {
+              key_sum += data[i].first;
+              mapped_sum += data[i].second;
+          }
+      }
+    );
+    results.enforce_exactly_equal(key_sum, 6);
+    results.enforce_exactly_equal(mapped_sum, 60);
+
+    // next_block directly
+    std::vector<int> buffer(4);
+    supl::iterator<const int> list_itr {list.begin()};
+    const supl::iterator<const int> list_end {list.end()};
+    results.enforce_exactly_equal(
+      list_itr.next_block(buffer.data(), 4, list_end), std::size_t {4}
+    );
+    results.enforce_equal(buffer, std::vector {1, 2, 3, 4});
+    results.enforce_exactly_equal(*list_itr, 5);
+
+    const supl::iterator<const int> mismatched_end {deque.end()};
+    results.enforce_exactly_equal(
+      list_itr.next_block(buffer.data(), 4, mismatched_end),
+      std::size_t {0}
+    );
+
+    const std::list<throwing_copy> throwing(10);
+    enforce_no_leak(
+      results, throwing.begin(), throwing.end(), "throwing copy"
+    );
+    enforce_no_leak(
+      results, supl::iterator {throwing.begin()},
+      supl::iterator {throwing.end()}, "erased throwing copy"
+    );
+
+    return results.print_and_return();
+}
@@ -0,0 +1,68 @@
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    const std::size_t size {50001};
+
+    const std::vector<long> test_input(size, 3);
+    std::vector<long> test_output(size);
+    std::iota(test_output.begin(), test_output.end(), 0L);
+
+    std::vector<long> reference_output(test_output);
+    supl::for_each_both_n(
+      test_input.cbegin(), reference_output.begin(), size,
+      [](const long in, long& out)
+      {
+          out *= in;
+      }
+    );
+
+    supl::for_each_both_n(
+      supl::parallel_policy {3}, test_input.cbegin(), test_output.begin(),
+      size,
+      [](const long in, long& out)
+      {
+          out *= in;
+      }
+    );
+
+    results.enforce_exactly_equal(test_output, reference_output);
+
+    {
+        std::string what {};
+
+        try
+        {
+            supl::for_each_both_n(
+              supl::parallel_policy {4}, test_input.cbegin(),
+              test_output.cbegin(), size,
+              [](const long, const long out)
+              {
+                  if ( out == 3 * 12000 || out == 3 * 40000 )
+                  {
+                      throw std::runtime_error {std::to_string(out)};
+                  }
+              }
+            );
+        }
+        catch ( const std::runtime_error& error )
+        {
+            what = error.what();
+        }
+
+        results.enforce_exactly_equal(
+          what, std::string {"36000"},
+          "Exception from earliest chunk is rethrown"
+        );
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,118 @@
+#include <atomic>
+#include <deque>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    // unevenly sized ranges of mixed categories
+    std::vector<long> input_range1(30000);
+    std::iota(input_range1.begin(), input_range1.end(), 0L);
+    const std::deque<long> input_range2(17, 1);
+    const std::list<long> input_range3(5000, 2);
+    const std::vector<long> input_range4 {};
+    std::vector<long> input_range5(123457, 3);
+
+    const long expected_sum {
+      std::accumulate(input_range1.cbegin(), input_range1.cend(), 0L) + 17
+      + 5000 * 2 + 123457 * 3};
+    const long expected_count {30000 + 17 + 5000 + 123457};
+
+    for ( const std::size_t thread_count : {1UL, 2UL, 3UL, 8UL} )
+    {
+        std::atomic<long> sum {0};
+        std::atomic<long> count {0};
+
+        supl::for_each_chain(
+          supl::parallel_policy {thread_count},
+          [&sum, &count](const long value)
+          {
+              sum += value;
+              ++count;
+          },
+          input_range1.cbegin(), input_range1.cend(), input_range2.cbegin(),
+          input_range2.cend(), input_range3.cbegin(), input_range3.cend(),
+          input_range4.cbegin(), input_range4.cend(), input_range5.cbegin(),
+          input_range5.cend()
+        );
+
+        const std::string message {
+          "Thread count " + std::to_string(thread_count)};
+        results.enforce_exactly_equal(sum.load(), expected_sum, message);
+        results.enforce_exactly_equal(
+          count.load(), expected_count, message
+        );
+    }
+
+    {
+        // writing through the ranges
+        supl::for_each_chain(
+          supl::par,
+          [](long& value)
+          {
+              value *= 2;
+          },
+          input_range1.begin(), input_range1.end(), input_range5.begin(),
+          input_range5.end()
+        );
+
+        results.enforce_exactly_equal(
+          input_range1[29999], 59998L, "Mutable first range"
+        );
+        results.enforce_exactly_equal(
+          input_range5.front(), 6L, "Mutable second range"
+        );
+    }
+
+    {
+        int call_count {0};
+        supl::for_each_chain(
+          supl::parallel_policy {4},
+          [&call_count](const long)
+          {
+              ++call_count;
+          },
+          input_range4.cbegin(), input_range4.cend()
+        );
+
+        results.enforce_exactly_equal(call_count, 0, "Empty range");
+    }
+
+    {
+        std::string what {};
+
+        try
+        {
+            supl::for_each_chain(
+              supl::parallel_policy {4},
+              [](const long value)
+              {
+                  if ( value == 1 )
+                  {
+                      throw std::runtime_error {"thrown"};
+                  }
+              },
+              input_range5.cbegin(), input_range5.cend(),
+              input_range2.cbegin(), input_range2.cend()
+            );
+        }
+        catch ( const std::runtime_error& error )
+        {
+            what = error.what();
+        }
+
+        results.enforce_exactly_equal(
+          what, std::string {"thrown"}, "Exception is rethrown"
+        );
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,152 @@
+#include <array>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    const std::vector<int> test_input {1, 2, 3, 4, 5, 6};
+    const std::vector<int> reference_output {6, 9, 12, 15};
+
+    const auto sum_into {
+      [](std::vector<int>& output)
+      {
+          return [&output](const int a, const int b, const int c)
+          {
+              output.push_back(a + b + c);
+          };
+      }
+    };
+
+    {
+        std::vector<int> test_output;
+        supl::for_each_window<3>(
+          test_input.cbegin(), test_input.cend(), sum_into(test_output)
+        );
+        results.enforce_exactly_equal(
+          test_output, reference_output, "Contiguous"
+        );
+    }
+
+    {
+        const std::list<int> list_input(
+          test_input.cbegin(), test_input.cend()
+        );
+        std::vector<int> test_output;
+        supl::for_each_window<3>(
+          list_input.cbegin(), list_input.cend(), sum_into(test_output)
+        );
+        results.enforce_exactly_equal(
+          test_output, reference_output, "Bidirectional"
+        );
+    }
+
+    {
+        const std::forward_list<int> list_input(
+          test_input.cbegin(), test_input.cend()
+        );
+        std::vector<int> test_output;
+        supl::for_each_window<3>(
+          list_input.cbegin(), list_input.cend(), sum_into(test_output)
+        );
+        results.enforce_exactly_equal(
+          test_output, reference_output, "Forward"
+        );
+    }
+
+    {
+        std::vector<int> test_output;
+        supl::for_each_window<3>(
+          supl::iterator {test_input.cbegin()},
+          supl::iterator {test_input.cend()}, sum_into(test_output)
+        );
+        results.enforce_exactly_equal(
+          test_output, reference_output, "Erased contiguous"
+        );
+    }
+
+    {
+        const std::vector<int> short_input {1, 2};
+        const std::list<int> short_list {1, 2};
+        int call_count {0};
+        const auto count_calls {[&call_count](int, int, int)
+                                {
+                                    ++call_count;
+                                }};
+
+        supl::for_each_window<3>(
+          short_input.cbegin(), short_input.cend(), count_calls
+        );
+        supl::for_each_window<3>(
+          short_list.cbegin(), short_list.cend(), count_calls
+        );
+        supl::for_each_window<3>(
+          short_input.cend(), short_input.cend(), count_calls
+        );
+
+        results.enforce_exactly_equal(
+          call_count, 0, "Fewer elements than window size"
+        );
+    }
+
+    {
+        const std::list<std::string> words {"a", "b", "c", "d"};
+        std::vector<std::string> test_output;
+        const std::vector<std::string> expected {"ab", "bc", "cd"};
+
+        supl::for_each_window<2>(
+          words.cbegin(), words.cend(),
+          [&test_output](const std::string& lhs, const std::string& rhs)
+          {
+              test_output.push_back(lhs + rhs);
+          }
+        );
+
+        results.enforce_exactly_equal(
+          test_output, expected, "Non-trivial type"
+        );
+    }
+
+    {
+        std::vector<int> test_output;
+        supl::for_each_window<1>(
+          test_input.cbegin(), test_input.cend(),
+          [&test_output](const int value)
+          {
+              test_output.push_back(value);
+          }
+        );
+        results.enforce_exactly_equal(
+          test_output, test_input, "Window of one"
+        );
+    }
+
+    {
+        constexpr static std::array input {1, 2, 3, 4, 5};
+        constexpr static int result {
+          []()
+          {
+              int max_product {0};
+              supl::for_each_window<2>(
+                input.begin(), input.end(),
+                [&max_product](const int a, const int b)
+                {
+                    max_product = std::max(max_product, a * b);
+                }
+              );
+              return max_product;
+          }()
+        };
+
+        results.enforce_exactly_equal(result, 20, "Constant evaluation");
+    }
+
+    return results.print_and_return();
+}
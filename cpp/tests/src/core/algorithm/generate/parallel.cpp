@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+#include "supl/utility.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    const std::size_t size {100001};
+
+    {
+        std::vector<std::size_t> test_output(size);
+        supl::generate(
+          supl::parallel_policy {3}, test_output.begin(), test_output.end(),
+          [](const std::size_t index)
+          {
+              return index * 2;
+          }
+        );
+
+        bool correct {true};
+        for ( std::size_t i {0}; i != size; ++i )
+        {
+            correct = correct && test_output[i] == i * 2;
+        }
+
+        results.enforce_true(
+          correct, "Each element generated from its index"
+        );
+    }
+
+    {
+        const auto random_fill {
+          [](const supl::parallel_policy policy)
+          {
+              std::vector<double> output(size);
+              supl::generate(
+                policy, output.begin(), output.end(),
+                [](const std::size_t index)
+                {
+                    supl::counter_rng rng {2024, index};
+                    std::uniform_real_distribution<double> dist {-1.0, 1.0};
+                    return dist(rng);
+                }
+              );
+              return output;
+          }
+        };
+
+        const std::vector<double> reference_output {
+          random_fill(supl::parallel_policy {1})};
+
+        for ( const std::size_t thread_count : {2UL, 5UL, 16UL} )
+        {
+            results.enforce_true(
+              random_fill(supl::parallel_policy {thread_count})
+                == reference_output,
+              "Identical output with " + std::to_string(thread_count)
+                + " threads"
+            );
+        }
+
+        results.enforce_true(
+          random_fill(supl::par) == reference_output,
+          "Identical output with default policy"
+        );
+    }
+
+    {
+        std::vector<int> empty_output {};
+        int call_count {0};
+        supl::generate(
+          supl::parallel_policy {4}, empty_output.begin(),
+          empty_output.end(),
+          [&call_count](const std::size_t)
+          {
+              ++call_count;
+              return 0;
+          }
+        );
+
+        results.enforce_exactly_equal(call_count, 0, "Empty range");
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,137 @@
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    std::vector<int> test_input(20000);
+    std::iota(test_input.begin(), test_input.end(), 0);
+
+    const auto is_interesting {[](const int value)
+                               {
+                                   return value % 3 == 0 || value % 7 == 0;
+                               }};
+    const auto times_three {[](const int value)
+                            {
+                                return value * 3;
+                            }};
+
+    std::vector<int> reference_output;
+    supl::transform_if(
+      test_input.cbegin(), test_input.cend(),
+      std::back_inserter(reference_output), is_interesting, times_three
+    );
+
+    for ( const std::size_t thread_count : {1UL, 2UL, 3UL, 7UL, 64UL} )
+    {
+        std::vector<int> test_output(test_input.size(), -1);
+        const auto output_end {supl::transform_if(
+          supl::parallel_policy {thread_count}, test_input.cbegin(),
+          test_input.cend(), test_output.begin(), is_interesting,
+          times_three
+        )};
+
+        const std::string message {
+          "Thread count " + std::to_string(thread_count)};
+
+        results.enforce_exactly_equal(
+          static_cast<std::size_t>(
+            std::distance(test_output.begin(), output_end)
+          ),
+          reference_output.size(), message
+        );
+
+        test_output.erase(output_end, test_output.end());
+        results.enforce_exactly_equal(
+          test_output, reference_output, message
+        );
+    }
+
+    {
+        std::vector<int> test_output(test_input.size());
+        const auto output_end {supl::transform_if(
+          supl::par, test_input.cbegin(), test_input.cend(),
+          test_output.begin(), is_interesting, times_three
+        )};
+        test_output.erase(output_end, test_output.end());
+
+        results.enforce_exactly_equal(
+          test_output, reference_output, "Default policy"
+        );
+    }
+
+    {
+        // more threads than elements
+        const std::vector<int> small_input {1, 2, 3, 4, 5};
+        std::vector<int> test_output(small_input.size());
+        const std::vector<int> small_reference {6, 12};
+
+        const auto output_end {supl::transform_if(
+          supl::parallel_policy {16}, small_input.cbegin(),
+          small_input.cend(), test_output.begin(),
+          [](const int value)
+          {
+              return value % 2 == 0;
+          },
+          times_three
+        )};
+        test_output.erase(output_end, test_output.end());
+
+        results.enforce_exactly_equal(
+          test_output, small_reference, "More threads than elements"
+        );
+    }
+
+    {
+        const std::vector<int> empty_input {};
+        std::vector<int> test_output {};
+
+        const auto output_end {supl::transform_if(
+          supl::parallel_policy {4}, empty_input.cbegin(),
+          empty_input.cend(), test_output.begin(), is_interesting,
+          times_three
+        )};
+
+        results.enforce_true(
+          output_end == test_output.begin(), "Empty input"
+        );
+    }
+
+    {
+        std::vector<int> test_output(test_input.size());
+        std::string what {};
+
+        try
+        {
+            supl::transform_if(
+              supl::parallel_policy {4}, test_input.cbegin(),
+              test_input.cend(), test_output.begin(), is_interesting,
+              [](const int value)
+              {
+                  if ( value == 6000 || value == 16002 )
+                  {
+                      throw std::runtime_error {std::to_string(value)};
+                  }
+                  return value;
+              }
+            );
+        }
+        catch ( const std::runtime_error& error )
+        {
+            what = error.what();
+        }
+
+        results.enforce_exactly_equal(
+          what, std::string {"6000"},
+          "Exception from earliest chunk is rethrown"
+        );
+    }
+
+    return results.print_and_return();
+}
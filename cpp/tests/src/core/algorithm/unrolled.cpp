@@ -0,0 +1,186 @@
+#include <array>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/fake_ranges.hpp"
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+// Unroll factors which do and do not divide the sizes tested
+template <std::size_t Unroll>
+static void test_unroll(supl::test_results& results)
+{
+    const std::string suffix {" unrolled by " + std::to_string(Unroll)};
+
+    for ( const std::size_t size : {0UL, 1UL, 7UL, 8UL, 9UL, 100UL} )
+    {
+        std::vector<int> input(size);
+        std::iota(input.begin(), input.end(), 1);
+        const std::list<int> list_input(input.cbegin(), input.cend());
+
+        std::vector<int> visited;
+        supl::for_each<Unroll>(
+          input.cbegin(), input.cend(),
+          [&visited](const int value)
+          {
+              visited.push_back(value);
+          }
+        );
+        results.enforce_exactly_equal(
+          visited, input, "for_each" + suffix
+        );
+
+        std::vector<int> list_visited;
+        supl::for_each<Unroll>(
+          list_input.cbegin(), list_input.cend(),
+          [&list_visited](const int value)
+          {
+              list_visited.push_back(value);
+          }
+        );
+        results.enforce_exactly_equal(
+          list_visited, input, "for_each over list" + suffix
+        );
+
+        std::vector<int> erased_visited;
+        supl::for_each<Unroll>(
+          supl::iterator {input.cbegin()}, supl::iterator {input.cend()},
+          [&erased_visited](const int value)
+          {
+              erased_visited.push_back(value);
+          }
+        );
+        results.enforce_exactly_equal(
+          erased_visited, input, "for_each over erased" + suffix
+        );
+
+        std::vector<int> transformed(size);
+        std::vector<int> expected_transformed(size);
+        supl::transform<Unroll>(
+          input.cbegin(), input.cend(), transformed.begin(),
+          [](const int value)
+          {
+              return value * 3;
+          }
+        );
+        supl::transform(
+          input.cbegin(), input.cend(), expected_transformed.begin(),
+          [](const int value)
+          {
+              return value * 3;
+          }
+        );
+        results.enforce_exactly_equal(
+          transformed, expected_transformed, "transform" + suffix
+        );
+
+        std::vector<int> generated(size);
+        supl::generate<Unroll>(
+          generated.begin(), generated.end(),
+          [count {0}]() mutable
+          {
+              return ++count;
+          }
+        );
+        results.enforce_exactly_equal(
+          generated, input, "generate calls in order" + suffix
+        );
+
+        std::vector<int> zipped;
+        supl::zip_apply_n<Unroll>(
+          [&zipped](const int lhs, const int rhs)
+          {
+              zipped.push_back(lhs - rhs);
+          },
+          size, input.cbegin(), list_input.cbegin()
+        );
+        results.enforce_exactly_equal(
+          zipped, std::vector<int>(size, 0), "zip_apply_n mixed" + suffix
+        );
+
+        std::vector<int> zipped_indexed(size);
+        std::vector<int> expected_doubled(input);
+        for ( int& value : expected_doubled )
+        {
+            value *= 2;
+        }
+        supl::zip_apply_n<Unroll>(
+          [](const int lhs, int& out)
+          {
+              out = lhs * 2;
+          },
+          size, input.cbegin(), zipped_indexed.begin()
+        );
+        results.enforce_exactly_equal(
+          zipped_indexed, expected_doubled, "zip_apply_n indexed" + suffix
+        );
+    }
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_unroll<1>(results);
+    test_unroll<4>(results);
+    test_unroll<8>(results);
+
+    {
+        // iterators which may only be dereferenced when non-const
+        supl::fr::iota<int> iota {0, 10};
+        std::vector<int> out(10);
+
+        int sum {0};
+        supl::for_each<4>(
+          iota.begin(), iota.end(),
+          [&sum](const int value)
+          {
+              sum += value;
+          }
+        );
+        results.enforce_exactly_equal(sum, 45, "for_each iota");
+
+        supl::transform<4>(
+          iota.begin(), iota.end(), out.begin(),
+          [](const int value)
+          {
+              return value * 2;
+          }
+        );
+        results.enforce_exactly_equal(out[9], 18, "transform iota");
+
+        supl::zip_apply_n<4>(
+          [](const int value, int& result)
+          {
+              result = value;
+          },
+          out.size(), iota.begin(), out.begin()
+        );
+        results.enforce_exactly_equal(out[9], 9, "zip_apply_n iota");
+    }
+
+    {
+        constexpr static std::array input {1, 2, 3, 4, 5, 6, 7};
+        constexpr static int sum {
+          []()
+          {
+              int result {0};
+              supl::for_each<4>(
+                input.begin(), input.end(),
+                [&result](const int value)
+                {
+                    result += value;
+                }
+              );
+              return result;
+          }()
+        };
+
+        results.enforce_exactly_equal(sum, 28, "Constant evaluation");
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,95 @@
+#include <array>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    {
+        // all random access, shortest range in the middle
+        const std::vector test_1 {1, 2, 3, 4, 5};
+        const std::deque test_2 {10, 20, 30};
+        const std::array test_3 {100, 200, 300, 400};
+        std::vector<int> test_output;
+        const std::vector reference_output {111, 222, 333};
+
+        supl::zip_apply(
+          [&test_output](const int a, const int b, const int c)
+          {
+              test_output.push_back(a + b + c);
+          },
+          test_1.begin(), test_1.end(), test_2.begin(), test_2.end(),
+          test_3.begin(), test_3.end()
+        );
+
+        results.enforce_exactly_equal(
+          test_output, reference_output, "Random access"
+        );
+    }
+
+    {
+        // all random access, writing through one range
+        const std::vector test_1 {1, 2, 3, 4};
+        std::vector test_2 {0, 0, 0, 0, 0, 0};
+        const std::vector reference_output {2, 4, 6, 8, 0, 0};
+
+        supl::zip_apply(
+          [](const int a, int& b)
+          {
+              b = a * 2;
+          },
+          test_1.begin(), test_1.end(), test_2.begin(), test_2.end()
+        );
+
+        results.enforce_exactly_equal(
+          test_2, reference_output, "Random access, mutable range"
+        );
+    }
+
+    {
+        // one empty range
+        const std::vector test_1 {1, 2, 3};
+        const std::vector<int> test_2 {};
+        int call_count {0};
+
+        supl::zip_apply(
+          [&call_count](const int, const int)
+          {
+              ++call_count;
+          },
+          test_1.begin(), test_1.end(), test_2.begin(), test_2.end()
+        );
+
+        results.enforce_exactly_equal(call_count, 0, "Empty range");
+    }
+
+    {
+        // mixed categories take the general path
+        const std::vector test_1 {1, 2, 3, 4, 5};
+        const std::list test_2 {10, 20, 30, 40};
+        const std::forward_list test_3 {100, 200, 300};
+        std::vector<int> test_output;
+        const std::vector reference_output {111, 222, 333};
+
+        supl::zip_apply(
+          [&test_output](const int a, const int b, const int c)
+          {
+              test_output.push_back(a + b + c);
+          },
+          test_1.begin(), test_1.end(), test_2.begin(), test_2.end(),
+          test_3.begin(), test_3.end()
+        );
+
+        results.enforce_exactly_equal(
+          test_output, reference_output, "Mixed categories"
+        );
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,104 @@
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    const std::size_t size {100003};
+
+    std::vector<int> test_input_1(size);
+    std::vector<double> test_input_2(size);
+    std::iota(test_input_1.begin(), test_input_1.end(), 0);
+    std::iota(test_input_2.begin(), test_input_2.end(), 0.5);
+
+    std::vector<double> reference_output(size);
+    supl::zip_apply_n(
+      [](const int a, const double b, double& out)
+      {
+          out = a + b;
+      },
+      size, test_input_1.cbegin(), test_input_2.cbegin(),
+      reference_output.begin()
+    );
+
+    for ( const std::size_t thread_count : {1UL, 2UL, 5UL, 16UL} )
+    {
+        std::vector<double> test_output(size);
+        supl::zip_apply_n(
+          supl::parallel_policy {thread_count},
+          [](const int a, const double b, double& out)
+          {
+              out = a + b;
+          },
+          size, test_input_1.cbegin(), test_input_2.cbegin(),
+          test_output.begin()
+        );
+
+        results.enforce_exactly_equal(
+          test_output, reference_output,
+          "Thread count " + std::to_string(thread_count)
+        );
+    }
+
+    {
+        // n shorter than the ranges, with small element types
+        std::vector<std::uint8_t> test_output(size, 0);
+        supl::zip_apply_n(
+          supl::par,
+          [](const int a, std::uint8_t& out)
+          {
+              out = static_cast<std::uint8_t>(a % 7 + 1);
+          },
+          1000, test_input_1.cbegin(), test_output.begin()
+        );
+
+        bool correct {true};
+        for ( std::size_t i {0}; i != size; ++i )
+        {
+            const auto expected {
+              i < 1000 ? static_cast<std::uint8_t>(i % 7 + 1)
+                       : std::uint8_t {0}};
+            correct = correct && test_output[i] == expected;
+        }
+
+        results.enforce_true(correct, "Only the first n elements visited");
+    }
+
+    {
+        int call_count {0};
+        supl::zip_apply_n(
+          supl::parallel_policy {4},
+          [&call_count](const int, const double)
+          {
+              ++call_count;
+          },
+          0, test_input_1.cbegin(), test_input_2.cbegin()
+        );
+
+        results.enforce_exactly_equal(call_count, 0, "Zero elements");
+    }
+
+    // chunk boundaries land on cache lines
+    results.enforce_exactly_equal(
+      supl::impl::parallel_cache_line_granularity<int, double>,
+      std::size_t {16}, "Granularity of int and double"
+    );
+
+    results.enforce_exactly_equal(
+      supl::impl::parallel_chunk_begin(1000, 3, 1, 16), std::size_t {336},
+      "Chunk boundary is a multiple of granularity"
+    );
+
+    results.enforce_exactly_equal(
+      supl::impl::parallel_chunk_begin(1000, 3, 3, 16), std::size_t {1000},
+      "Last chunk boundary is the end"
+    );
+
+    return results.print_and_return();
+}
@@ -0,0 +1,169 @@
+#include <cstring>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/functional.hpp"
+#include "supl/test_results.hpp"
+#include "supl/utility.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    {
+        const std::vector<int> lhs {1, 2, 3, 4};
+        const std::list<int> rhs {10, 20, 30, 40, 50};
+
+        results.enforce_exactly_equal(
+          supl::zip_transform_reduce(
+            0, std::plus<> {}, std::multiplies<> {}, lhs.cbegin(),
+            lhs.cend(), rhs.cbegin(), rhs.cend()
+          ),
+          300, "Dot product, shortest range wins"
+        );
+
+        results.enforce_exactly_equal(
+          supl::zip_transform_reduce_n(
+            5, std::plus<> {}, std::multiplies<> {}, 2, lhs.cbegin(),
+            rhs.cbegin()
+          ),
+          55, "Dot product of first n, with init"
+        );
+    }
+
+    {
+        // weighted sum over three columns
+        const std::vector<double> values {1.0, 2.0, 3.0};
+        const std::vector<double> weights {0.5, 0.25, 2.0};
+        const std::vector<int> mask {1, 0, 1};
+
+        results.enforce_floating_point_approx(
+          supl::zip_transform_reduce(
+            0.0, std::plus<> {},
+            [](const double value, const double weight, const int keep)
+            {
+                return keep != 0 ? value * weight : 0.0;
+            },
+            values.cbegin(), values.cend(), weights.cbegin(),
+            weights.cend(), mask.cbegin(), mask.cend()
+          ),
+          6.5, 0.0, "Three ranges"
+        );
+    }
+
+    {
+        const std::vector<int> empty {};
+        results.enforce_exactly_equal(
+          supl::zip_transform_reduce(
+            42, std::plus<> {}, supl::identity {}, empty.cbegin(),
+            empty.cend()
+          ),
+          42, "Empty range gives init"
+        );
+    }
+
+    {
+        // concatenation is associative but not commutative,
+        // so this checks that operands are never reordered
+        std::vector<int> digits(1000);
+        std::iota(digits.begin(), digits.end(), 0);
+        const auto to_digit {
+          [](const int value)
+          {
+              return std::to_string(value % 10);
+          }
+        };
+
+        std::string expected {"init:"};
+        for ( const int digit : digits )
+        {
+            expected += to_digit(digit);
+        }
+
+        results.enforce_exactly_equal(
+          supl::zip_transform_reduce(
+            std::string {"init:"}, std::plus<> {}, to_digit,
+            digits.cbegin(), digits.cend()
+          ),
+          expected, "Order preserved"
+        );
+
+        for ( const std::size_t thread_count : {1UL, 3UL, 7UL} )
+        {
+            results.enforce_exactly_equal(
+              supl::zip_transform_reduce(
+                supl::parallel_policy {thread_count}, std::string {"init:"},
+                std::plus<> {}, to_digit, digits.cbegin(), digits.cend()
+              ),
+              expected,
+              "Order preserved with " + std::to_string(thread_count)
+                + " threads"
+            );
+        }
+    }
+
+    {
+        // a naive float sum of ten million 0.1s drifts far from 1e6
+        const std::vector<float> tenths(10'000'000, 0.1F);
+
+        const float sum {supl::zip_transform_reduce(
+          0.0F, std::plus<> {}, supl::identity {}, tenths.cbegin(),
+          tenths.cend()
+        )};
+
+        results.enforce_floating_point_approx(
+          static_cast<double>(sum), 1e6, 1.0,
+          "Pairwise float sum is accurate"
+        );
+    }
+
+    {
+        std::vector<double> lhs(200003);
+        std::vector<double> rhs(200003);
+        const auto fill {
+          [](std::vector<double>& output, const std::uint64_t seed)
+          {
+              supl::generate(
+                supl::par, output.begin(), output.end(),
+                [seed](const std::size_t index)
+                {
+                    supl::counter_rng rng {seed, index};
+                    std::uniform_real_distribution<double> dist {-1e6, 1e6};
+                    return dist(rng);
+                }
+              );
+          }
+        };
+        fill(lhs, 1);
+        fill(rhs, 2);
+
+        const double serial {supl::zip_transform_reduce(
+          0.0, std::plus<> {}, std::multiplies<> {}, lhs.cbegin(),
+          lhs.cend(), rhs.cbegin(), rhs.cend()
+        )};
+
+        bool identical {true};
+        for ( const std::size_t thread_count : {1UL, 2UL, 5UL, 16UL} )
+        {
+            const double parallel {supl::zip_transform_reduce(
+              supl::parallel_policy {thread_count}, 0.0, std::plus<> {},
+              std::multiplies<> {}, lhs.cbegin(), lhs.cend(), rhs.cbegin(),
+              rhs.cend()
+            )};
+
+            identical = identical
+                     && std::memcmp(&serial, &parallel, sizeof(double)) == 0;
+        }
+
+        results.enforce_true(
+          identical, "Parallel result is bit-identical to serial"
+        );
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,257 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/predicates.hpp"
+#include "supl/test_results.hpp"
+
+// Count without going through `supl::fr`, as a reference
+template <typename Container, typename Pred>
+static auto reference_count(const Container& container, const Pred& pred)
+  -> std::ptrdiff_t
+{
+    std::ptrdiff_t count {0};
+    for ( const auto& element : container )
+    {
+        if ( pred(element) )
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// Values spanning the whole range of `T`, including the extremes,
+// repeated to fill `size` elements
+template <typename T>
+static auto make_input(const std::size_t size) -> std::vector<T>
+{
+    const std::array<T, 8> pattern {
+      std::numeric_limits<T>::lowest(),
+      std::numeric_limits<T>::max(),
+      T {0},
+      T {1},
+      static_cast<T>(std::numeric_limits<T>::max() / 2),
+      static_cast<T>(std::numeric_limits<T>::lowest() / 2),
+      static_cast<T>(std::is_signed_v<T> ? -1 : 2),
+      T {1}};
+
+    std::vector<T> input(size);
+    for ( std::size_t i {0}; i != size; ++i )
+    {
+        input[i] = pattern[(i * 5) % pattern.size()];
+    }
+    return input;
+}
+
+template <typename T>
+static void test_type(supl::test_results& results, const std::string& name)
+{
+    const std::array<T, 4> operands {
+      std::numeric_limits<T>::lowest(), T {0}, T {1},
+      std::numeric_limits<T>::max()};
+
+    // every size up to a few registers' worth, to exercise the tails
+    for ( std::size_t size {0}; size != 70; ++size )
+    {
+        const std::vector<T> input {make_input<T>(size)};
+        const std::string suffix {" " + name + " size "
+                                  + std::to_string(size)};
+
+        for ( const T operand : operands )
+        {
+            results.enforce_exactly_equal(
+              supl::fr::count(input, operand),
+              reference_count(input, supl::equal_to(operand)),
+              "count" + suffix
+            );
+            results.enforce_exactly_equal(
+              supl::fr::count_if(input, supl::equal_to(operand)),
+              reference_count(input, supl::equal_to(operand)),
+              "count_if equal_to" + suffix
+            );
+            results.enforce_exactly_equal(
+              supl::fr::count_if(input, supl::less_than(operand)),
+              reference_count(input, supl::less_than(operand)),
+              "count_if less_than" + suffix
+            );
+            results.enforce_exactly_equal(
+              supl::fr::count_if(input, supl::greater_than(operand)),
+              reference_count(input, supl::greater_than(operand)),
+              "count_if greater_than" + suffix
+            );
+            results.enforce_exactly_equal(
+              supl::fr::count_if(input, supl::between(T {0}, operand)),
+              reference_count(input, supl::between(T {0}, operand)),
+              "count_if between" + suffix
+            );
+        }
+    }
+}
+
+static void test_floating_point(supl::test_results& results)
+{
+    const double nan {std::numeric_limits<double>::quiet_NaN()};
+    const double inf {std::numeric_limits<double>::infinity()};
+
+    std::vector<double> input;
+    for ( int i {0}; i != 37; ++i )
+    {
+        input.push_back(i % 3 == 0 ? nan : i - 18.5);
+    }
+    input.push_back(inf);
+    input.push_back(-inf);
+
+    results.enforce_exactly_equal(
+      supl::fr::count(input, nan), std::ptrdiff_t {0}, "NaN equals nothing"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(input, supl::less_than(0.0)),
+      reference_count(input, supl::less_than(0.0)), "NaN is not less"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(input, supl::greater_than(0.0)),
+      reference_count(input, supl::greater_than(0.0)),
+      "NaN is not greater"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(input, supl::between(-inf, inf)),
+      std::ptrdiff_t {26}, "NaN is not between"
+    );
+
+    const std::vector<float> floats {0.0F, -0.0F, 1.5F, -1.5F, 0.0F,
+                                     2.5F, 3.5F,  4.5F, 5.5F,  -0.0F};
+    results.enforce_exactly_equal(
+      supl::fr::count(floats, 0.0F), std::ptrdiff_t {4},
+      "negative zero equals zero"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(floats, supl::between(-1.5F, 2.5F)),
+      std::ptrdiff_t {7}, "between is inclusive"
+    );
+}
+
+static void test_operand_conversion(supl::test_results& results)
+{
+    const std::vector<unsigned char> bytes(40, 200);
+
+    // 200 is out of range of `signed char`, so converting the operand
+    // to the element type would wrongly match
+    results.enforce_exactly_equal(
+      supl::fr::count(bytes, static_cast<signed char>(-56)),
+      std::ptrdiff_t {0}, "narrower operand of other signedness"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count(bytes, 200), std::ptrdiff_t {40}, "wider operand"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(bytes, supl::less_than(456)), std::ptrdiff_t {40},
+      "wider operand out of range"
+    );
+
+    const std::vector<int> ints {-3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+    results.enforce_exactly_equal(
+      supl::fr::count_if(ints, supl::less_than(1.5)), std::ptrdiff_t {5},
+      "floating operand"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(ints, supl::greater_than(short {4})),
+      std::ptrdiff_t {4}, "narrower operand"
+    );
+
+    // mixed signedness follows the usual arithmetic conversions
+    const std::vector<unsigned> unsigned_ints(20, 5U);
+    results.enforce_exactly_equal(
+      supl::fr::count_if(
+        unsigned_ints, supl::greater_than(static_cast<unsigned>(-1))
+      ),
+      std::ptrdiff_t {0}, "unsigned max"
+    );
+}
+
+static void test_fallbacks(supl::test_results& results)
+{
+    const std::list<int> list {1, 2, 3, 2, 1};
+    results.enforce_exactly_equal(
+      supl::fr::count(list, 2), std::ptrdiff_t {2}, "count list"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(list, supl::less_than(3)), std::ptrdiff_t {4},
+      "count_if list"
+    );
+
+    const std::vector<int> vec {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    results.enforce_exactly_equal(
+      supl::fr::count_if(vec, supl::less_eq(3)), std::ptrdiff_t {3},
+      "unrecognized predicate"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(
+        vec, supl::greater_than(2) && supl::less_than(9)
+      ),
+      std::ptrdiff_t {6}, "composed predicate"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(
+        vec,
+        [](const int value)
+        {
+            return value % 2 == 0;
+        }
+      ),
+      std::ptrdiff_t {5}, "lambda"
+    );
+
+    const std::array<long long, 6> array {5, 5, 6, 7, 5, 8};
+    results.enforce_exactly_equal(
+      supl::fr::count(array, 5), std::ptrdiff_t {3}, "count array"
+    );
+
+    const std::vector<std::string> strings {"a", "b", "a"};
+    results.enforce_exactly_equal(
+      supl::fr::count_if(strings, supl::equal_to(std::string {"a"})),
+      std::ptrdiff_t {2}, "non-arithmetic elements"
+    );
+
+    using supl::fr::impl::is_simd_count_if;
+    static_assert(is_simd_count_if<
+                  std::vector<int>::const_iterator,
+                  decltype(supl::less_than(1))>::value);
+    static_assert(not is_simd_count_if<
+                  std::list<int>::const_iterator,
+                  decltype(supl::less_than(1))>::value);
+    static_assert(not is_simd_count_if<
+                  std::vector<int>::const_iterator,
+                  decltype(supl::less_eq(1))>::value);
+    static_assert(not is_simd_count_if<
+                  std::vector<char>::const_iterator,
+                  decltype(supl::less_than(1))>::value);
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_type<std::int8_t>(results, "int8");
+    test_type<std::uint8_t>(results, "uint8");
+    test_type<std::int16_t>(results, "int16");
+    test_type<std::uint16_t>(results, "uint16");
+    test_type<std::int32_t>(results, "int32");
+    test_type<std::uint32_t>(results, "uint32");
+    test_type<std::int64_t>(results, "int64");
+    test_type<std::uint64_t>(results, "uint64");
+    test_type<float>(results, "float");
+    test_type<double>(results, "double");
+
+    test_floating_point(results);
+    test_operand_conversion(results);
+    test_fallbacks(results);
+
+    return results.print_and_return();
+}
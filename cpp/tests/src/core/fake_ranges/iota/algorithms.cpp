@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/fake_ranges.hpp"
+#include "supl/test_results.hpp"
+
+// Iterators of `fr::iota` compute their values, so subscripting them
+// yields a value rather than `reference`.
+// Algorithms which index random access iterators must still accept them,
+// including with callables taking their elements by lvalue reference.
+
+static void test_for_each_both_n(supl::test_results& results)
+{
+    supl::fr::iota<int> iota {0, 5};
+    std::vector<int> out(5);
+
+    supl::for_each_both_n(
+      iota.begin(), out.begin(), out.size(),
+      [](int& value, int& result)
+      {
+          result = value * 2;
+      }
+    );
+
+    results.enforce_equal(out, std::vector {0, 2, 4, 6, 8});
+}
+
+static void test_zip_apply(supl::test_results& results)
+{
+    supl::fr::iota<int> iota {1, 6};
+    std::vector<int> out(5);
+
+    supl::zip_apply_n(
+      [](int& value, int& result)
+      {
+          result = value + 10;
+      },
+      out.size(), iota.begin(), out.begin()
+    );
+    results.enforce_equal(out, std::vector {11, 12, 13, 14, 15}, "n");
+
+    supl::zip_apply_n<2>(
+      [](int& value, int& result)
+      {
+          result = value * value;
+      },
+      out.size(), iota.begin(), out.begin()
+    );
+    results.enforce_equal(out, std::vector {1, 4, 9, 16, 25}, "unrolled");
+
+    supl::zip_apply(
+      [](int& value, int& result)
+      {
+          result = -value;
+      },
+      iota.begin(), iota.end(), out.begin(), out.end()
+    );
+    results.enforce_equal(
+      out, std::vector {-1, -2, -3, -4, -5}, "begin end pairs"
+    );
+}
+
+static void test_unrolled(supl::test_results& results)
+{
+    supl::fr::iota<int> iota {0, 10, 3};
+
+    int sum {0};
+    supl::for_each<4>(
+      iota.begin(), iota.end(),
+      [&sum](int& value)
+      {
+          sum += value;
+      }
+    );
+    results.enforce_exactly_equal(sum, 0 + 3 + 6 + 9, "for_each");
+
+    std::vector<int> out(iota.size());
+    supl::transform<4>(
+      iota.begin(), iota.end(), out.begin(),
+      [](const int value)
+      {
+          return value + 1;
+      }
+    );
+    results.enforce_equal(out, std::vector {1, 4, 7, 10}, "transform");
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_for_each_both_n(results);
+    test_zip_apply(results);
+    test_unrolled(results);
+
+    return results.print_and_return();
+}
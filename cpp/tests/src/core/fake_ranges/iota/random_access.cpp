@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/fake_ranges.hpp"
+#include "supl/test_results.hpp"
+
+static_assert(std::is_same_v<
+              std::iterator_traits<
+                supl::fr::iota<int>::iterator>::iterator_category,
+              std::random_access_iterator_tag>);
+static_assert(std::is_same_v<
+              std::iterator_traits<
+                supl::fr::iota<std::list<int>::iterator>::iterator
+              >::iterator_category,
+              std::bidirectional_iterator_tag>);
+
+// Values of every `T` tested are whole numbers,
+// so floating point values compare exactly
+template <typename T>
+static void enforce_value(
+  supl::test_results& results, const T result, const T expected,
+  const std::string_view message
+)
+{
+    if constexpr ( std::is_floating_point_v<T> )
+    {
+        results.enforce_floating_point_approx(
+          static_cast<double>(result), static_cast<double>(expected), 0.0,
+          message
+        );
+    }
+    else
+    {
+        results.enforce_exactly_equal(result, expected, message);
+    }
+}
+
+template <typename T>
+static void test_arithmetic(supl::test_results& results)
+{
+    const supl::fr::iota<T> test_range {T {3}, T {13}};
+
+    results.enforce_exactly_equal(
+      test_range.size(), std::size_t {10}, "size"
+    );
+    results.enforce_exactly_equal(
+      std::distance(test_range.begin(), test_range.end()),
+      std::ptrdiff_t {10}, "std::distance"
+    );
+    results.enforce_exactly_equal(
+      test_range.begin() - test_range.end(), std::ptrdiff_t {-10},
+      "Negative distance"
+    );
+
+    auto itr {test_range.begin()};
+    itr += 4;
+    enforce_value(results, *itr, T {7}, "+=");
+    itr -= 3;
+    enforce_value(results, *itr, T {4}, "-=");
+    enforce_value(results, *(itr + 2), T {6}, "+");
+    enforce_value(results, *(2 + itr), T {6}, "+ reversed");
+    enforce_value(results, *(itr + -1), T {3}, "+ negative");
+    enforce_value(results, *(itr - 1), T {3}, "-");
+    enforce_value(results, itr[5], T {9}, "[]");
+
+    results.enforce_true(test_range.begin() < itr, "<");
+    results.enforce_true(itr > test_range.begin(), ">");
+    results.enforce_true(itr <= itr, "<=");
+    results.enforce_true(itr >= itr, ">=");
+    results.enforce_false(itr < itr, "Not <");
+
+    std::vector<T> reversed(test_range.size());
+    std::reverse_copy(
+      test_range.begin(), test_range.end(), reversed.begin()
+    );
+    enforce_value(results, reversed.front(), T {12}, "std::reverse_copy");
+    enforce_value(results, reversed.back(), T {3}, "std::reverse_copy");
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_arithmetic<int>(results);
+    test_arithmetic<std::size_t>(results);
+    test_arithmetic<std::uint8_t>(results);
+    test_arithmetic<std::uint32_t>(results);
+    test_arithmetic<double>(results);
+
+    {
+        constexpr static supl::fr::iota<int> test_range {-5, 5};
+        static_assert(test_range.size() == 10);
+        static_assert(test_range.cbegin()[7] == 2);
+        static_assert(test_range.cend() - test_range.cbegin() == 10);
+    }
+
+    {
+        // random access lets the range be split across threads
+        const supl::fr::iota<std::size_t> test_range {0, 50000};
+        std::vector<std::size_t> test_output(test_range.size());
+
+        supl::zip_apply_n(
+          supl::parallel_policy {4},
+          [](const std::size_t index, std::size_t& out)
+          {
+              out = index * 2;
+          },
+          test_range.size(), test_range.begin(), test_output.begin()
+        );
+
+        results.enforce_true(
+          std::all_of(
+            test_range.begin(), test_range.end(),
+            [&test_output](const std::size_t index)
+            {
+                return test_output[index] == index * 2;
+            }
+          ),
+          "Parallel zip_apply_n"
+        );
+    }
+
+    return results.print_and_return();
+}
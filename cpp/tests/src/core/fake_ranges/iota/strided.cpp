@@ -0,0 +1,227 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/test_results.hpp"
+
+template <typename T>
+static auto to_vector(const supl::fr::iota<T>& range) -> std::vector<T>
+{
+    return std::vector<T>(range.begin(), range.end());
+}
+
+static void test_integral(supl::test_results& results)
+{
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::iota<int> {0, 10, 3}), std::vector {0, 3, 6, 9},
+      "Step which does not divide the range"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::iota<int> {0, 10, 3}.size(), std::size_t {4},
+      "Size with step"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::iota<int> {0, 9, 3}), std::vector {0, 3, 6},
+      "Step which divides the range"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::iota<int> {10, 0, -3}),
+      std::vector {10, 7, 4, 1}, "Negative step"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::iota<std::size_t> {1, 10, 2}),
+      std::vector<std::size_t> {1, 3, 5, 7, 9}, "Unsigned"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::iota<int> {5, 5, 2}.size(), std::size_t {0}, "Empty"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::iota<int> {5, 0, 2}.size(), std::size_t {0},
+      "End before begin"
+    );
+    results.enforce_exactly_equal(
+      supl::fr::iota<int> {0, 10, -1}.size(), std::size_t {0},
+      "Step away from end"
+    );
+
+    const supl::fr::iota<int> range {-4, 20, 4};
+    results.enforce_exactly_equal(
+      range.begin()[3], 8, "Indexing with step"
+    );
+    results.enforce_exactly_equal(
+      *(range.end() - 1), 16, "Last value with step"
+    );
+    results.enforce_exactly_equal(
+      range.end() - range.begin(), std::ptrdiff_t {6},
+      "Distance with step"
+    );
+}
+
+// Every value is compared exactly,
+// as each must be `begin + i * step` to the bit
+static void enforce_values(
+  supl::test_results& results, const supl::fr::iota<double>& range,
+  const double begin, const double step, const std::size_t size,
+  const std::string_view message
+)
+{
+    results.enforce_exactly_equal(range.size(), size, message);
+
+    std::size_t index {0};
+    for ( const double value : range )
+    {
+        results.enforce_floating_point_approx(
+          value, begin + static_cast<double>(index) * step, 0.0,
+          std::string {message} + " index " + std::to_string(index)
+        );
+        ++index;
+    }
+
+    results.enforce_exactly_equal(index, size, message);
+}
+
+static void test_floating_point(supl::test_results& results)
+{
+    enforce_values(
+      results, supl::fr::iota<double> {0.0, 1.0, 0.1}, 0.0, 0.1, 10,
+      "Tenths"
+    );
+
+    // 1.1 / 0.1 rounds up past 11
+    enforce_values(
+      results, supl::fr::iota<double> {0.0, 1.1, 0.1}, 0.0, 0.1, 11,
+      "Quotient rounded up"
+    );
+
+    // 0.7 / 0.1 rounds down below 7
+    enforce_values(
+      results, supl::fr::iota<double> {0.0, 0.7, 0.1}, 0.0, 0.1, 7,
+      "Quotient rounded down"
+    );
+
+    enforce_values(
+      results, supl::fr::iota<double> {1.0, 0.0, -0.25}, 1.0, -0.25, 4,
+      "Negative step"
+    );
+
+    enforce_values(
+      results, supl::fr::iota<double> {0.5, 3.5}, 0.5, 1.0, 3,
+      "Unit step"
+    );
+
+    // adding 0.1 repeatedly reaches 1.0 with an error of its own,
+    // which grows over a long range
+    {
+        const supl::fr::iota<double> range {0.0, 1000.0, 0.1};
+
+        double accumulated {0.0};
+        for ( std::ptrdiff_t i {0}; i != 9999; ++i )
+        {
+            accumulated += 0.1;
+        }
+
+        results.enforce_floating_point_approx(
+          range.begin()[9999], 9999 * 0.1, 0.0, "No drift"
+        );
+        results.enforce_floating_point_approx(
+          *(range.begin() + 9999), 9999 * 0.1, 0.0, "No drift"
+        );
+        results.enforce_true(
+          accumulated < 9999 * 0.1 || accumulated > 9999 * 0.1,
+          "Repeated addition does drift"
+        );
+    }
+
+    {
+        const supl::fr::iota test_range {0.0, 2.0, 0.5};
+        results.enforce_exactly_equal(
+          test_range.size(), std::size_t {4}, "Deduced type"
+        );
+    }
+}
+
+// Sequences reaching the limits of `T`, whose distances
+// or past-the-end values are not representable in `T`
+static void test_limits(supl::test_results& results)
+{
+    constexpr int int_max {std::numeric_limits<int>::max()};
+    constexpr int int_min {std::numeric_limits<int>::min()};
+    constexpr long long_max {std::numeric_limits<long>::max()};
+    constexpr long long_min {std::numeric_limits<long>::min()};
+
+    const supl::fr::iota<int> evens {0, int_max, 2};
+    results.enforce_exactly_equal(
+      evens.size(), std::size_t {1} << 30U, "Size up to int max"
+    );
+    results.enforce_exactly_equal(
+      *std::prev(evens.end()), int_max - 1, "Last value below int max"
+    );
+
+    const supl::fr::iota<long> longs {long_min, long_max};
+    results.enforce_exactly_equal(
+      longs.size(), std::numeric_limits<std::size_t>::max(),
+      "Size of every long but the max"
+    );
+    results.enforce_exactly_equal(
+      *std::prev(longs.end()), long_max - 1, "Last long"
+    );
+    results.enforce_exactly_equal(
+      longs.begin() < longs.end(), true, "Order across the whole range"
+    );
+
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::iota<int> {int_max, int_min, int_min}),
+      std::vector {int_max, -1}, "Step of int min"
+    );
+
+    std::vector<std::int8_t> expected;
+    for ( int value {-128}; value != 127; ++value )
+    {
+        expected.push_back(static_cast<std::int8_t>(value));
+    }
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::iota<std::int8_t> {-128, 127}), expected,
+      "Every int8 but the max"
+    );
+
+    std::vector<std::uint8_t> expected_unsigned;
+    for ( int value {248}; value >= 3; value -= 7 )
+    {
+        expected_unsigned.push_back(static_cast<std::uint8_t>(value));
+    }
+    const supl::fr::iota<std::uint8_t> bytes {3, 255, 7};
+    results.enforce_exactly_equal(
+      std::vector<std::uint8_t>(
+        std::make_reverse_iterator(bytes.end()),
+        std::make_reverse_iterator(bytes.begin())
+      ),
+      expected_unsigned, "Unsigned up to uint8 max, reversed"
+    );
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_integral(results);
+    test_floating_point(results);
+    test_limits(results);
+
+    {
+        constexpr static supl::fr::iota<int> test_range {0, 10, 3};
+        static_assert(test_range.size() == 4);
+        static_assert(test_range.cbegin()[2] == 6);
+        static_assert(*(test_range.cend() - 1) == 9);
+
+        constexpr static supl::fr::iota<double> floating_range {
+          0.0, 1.0, 0.25};
+        static_assert(floating_range.size() == 4);
+    }
+
+    return results.print_and_return();
+}
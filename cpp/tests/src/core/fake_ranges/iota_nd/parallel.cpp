@@ -0,0 +1,70 @@
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    constexpr std::size_t rows {123};
+    constexpr std::size_t columns {97};
+
+    for ( const auto& tile : {std::array<std::size_t, 2> {rows, columns},
+                              std::array<std::size_t, 2> {8, 8},
+                              std::array<std::size_t, 2> {5, 13}} )
+    {
+        const supl::fr::iota_nd<2> range {{rows, columns}, tile};
+
+        for ( const std::size_t thread_count : {1UL, 2UL, 3UL, 8UL} )
+        {
+            const std::string message {
+              "Tile " + std::to_string(tile[0]) + 'x'
+              + std::to_string(tile[1]) + ", thread count "
+              + std::to_string(thread_count)};
+
+            // each index is visited by one thread, so no two threads
+            // write the same element
+            std::vector<std::size_t> visits(rows * columns);
+            supl::fr::for_each(
+              supl::parallel_policy {thread_count}, range,
+              [&visits](const std::tuple<std::size_t, std::size_t> index)
+              {
+                  const auto [row, column] {index};
+                  visits[row * columns + column] += 1;
+              }
+            );
+
+            results.enforce_exactly_equal(
+              visits, std::vector<std::size_t>(rows * columns, 1), message
+            );
+        }
+    }
+
+    {
+        std::vector<int> values(10000);
+        std::iota(values.begin(), values.end(), 0);
+
+        supl::fr::for_each(
+          supl::par, values,
+          [](int& value)
+          {
+              value *= 2;
+          }
+        );
+
+        results.enforce_exactly_equal(
+          values[9999], 19998, "Parallel for_each over a container"
+        );
+        results.enforce_exactly_equal(
+          values[1234], 2468, "Parallel for_each over a container"
+        );
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/test_results.hpp"
+
+using index_2d = std::tuple<std::size_t, std::size_t>;
+using index_3d = std::tuple<std::size_t, std::size_t, std::size_t>;
+
+template <std::size_t N>
+static auto to_vector(const supl::fr::iota_nd<N>& range)
+  -> std::vector<typename supl::fr::iota_nd<N>::index_type>
+{
+    return {range.begin(), range.end()};
+}
+
+// Every position reached by jumping must match
+// the position reached by stepping
+template <std::size_t N>
+static void enforce_random_access(
+  supl::test_results& results, const supl::fr::iota_nd<N>& range,
+  const std::string& message
+)
+{
+    const auto expected {to_vector(range)};
+
+    for ( std::size_t i {0}; i != expected.size(); ++i )
+    {
+        const auto offset {static_cast<std::ptrdiff_t>(i)};
+        results.enforce_exactly_equal(
+          range.begin()[offset], expected[i], message + " []"
+        );
+        results.enforce_exactly_equal(
+          *(range.end() - (static_cast<std::ptrdiff_t>(expected.size())
+                           - offset)),
+          expected[i], message + " from end"
+        );
+    }
+
+    std::vector<typename supl::fr::iota_nd<N>::index_type> reversed;
+    for ( auto itr {range.end()}; itr != range.begin(); )
+    {
+        --itr;
+        reversed.push_back(*itr);
+    }
+    std::reverse(reversed.begin(), reversed.end());
+    results.enforce_exactly_equal(reversed, expected, message + " --");
+
+    results.enforce_exactly_equal(
+      std::distance(range.begin(), range.end()),
+      static_cast<std::ptrdiff_t>(range.size()), message + " distance"
+    );
+}
+
+static void test_row_major(supl::test_results& results)
+{
+    {
+        const supl::fr::iota_nd<2> range {{3, 4}};
+
+        std::vector<index_2d> expected;
+        for ( std::size_t i {0}; i != 3; ++i )
+        {
+            for ( std::size_t j {0}; j != 4; ++j )
+            {
+                expected.emplace_back(i, j);
+            }
+        }
+
+        results.enforce_exactly_equal(range.size(), std::size_t {12}, "2D");
+        results.enforce_exactly_equal(to_vector(range), expected, "2D");
+        enforce_random_access(results, range, "2D");
+    }
+
+    {
+        const supl::fr::iota_nd<3> range {{2, 3, 4}};
+
+        std::vector<index_3d> expected;
+        for ( std::size_t i {0}; i != 2; ++i )
+        {
+            for ( std::size_t j {0}; j != 3; ++j )
+            {
+                for ( std::size_t k {0}; k != 4; ++k )
+                {
+                    expected.emplace_back(i, j, k);
+                }
+            }
+        }
+
+        results.enforce_exactly_equal(to_vector(range), expected, "3D");
+        enforce_random_access(results, range, "3D");
+    }
+
+    {
+        const supl::fr::iota_nd<1> range {{5}};
+        results.enforce_exactly_equal(
+          to_vector(range),
+          std::vector<std::tuple<std::size_t>> {{0}, {1}, {2}, {3}, {4}},
+          "1D"
+        );
+    }
+
+    {
+        const supl::fr::iota_nd<2> range {{4, 0}};
+        results.enforce_exactly_equal(
+          range.size(), std::size_t {0}, "Empty extent"
+        );
+        results.enforce_true(
+          range.begin() == range.end(), "Empty extent"
+        );
+    }
+}
+
+static void test_tiled(supl::test_results& results)
+{
+    {
+        // tiles do not divide the grid, so the last of each are clipped
+        const supl::fr::iota_nd<2> range {{5, 7}, {2, 3}};
+
+        std::vector<index_2d> expected;
+        for ( std::size_t ti {0}; ti < 5; ti += 2 )
+        {
+            for ( std::size_t tj {0}; tj < 7; tj += 3 )
+            {
+                for ( std::size_t i {ti}; i != std::min(ti + 2, 5UL); ++i )
+                {
+                    for ( std::size_t j {tj}; j != std::min(tj + 3, 7UL);
+                          ++j )
+                    {
+                        expected.emplace_back(i, j);
+                    }
+                }
+            }
+        }
+
+        results.enforce_exactly_equal(
+          range.size(), std::size_t {35}, "Tiled 2D"
+        );
+        results.enforce_exactly_equal(
+          to_vector(range), expected, "Tiled 2D"
+        );
+        enforce_random_access(results, range, "Tiled 2D");
+    }
+
+    {
+        const supl::fr::iota_nd<3> range {{5, 4, 3}, {2, 3, 2}};
+
+        std::vector<index_3d> expected;
+        for ( std::size_t ti {0}; ti < 5; ti += 2 )
+        {
+            for ( std::size_t tj {0}; tj < 4; tj += 3 )
+            {
+                for ( std::size_t tk {0}; tk < 3; tk += 2 )
+                {
+                    for ( std::size_t i {ti}; i != std::min(ti + 2, 5UL);
+                          ++i )
+                    {
+                        for ( std::size_t j {tj}; j != std::min(tj + 3, 4UL);
+                              ++j )
+                        {
+                            for ( std::size_t k {tk};
+                                  k != std::min(tk + 2, 3UL); ++k )
+                            {
+                                expected.emplace_back(i, j, k);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        results.enforce_exactly_equal(
+          to_vector(range), expected, "Tiled 3D"
+        );
+        enforce_random_access(results, range, "Tiled 3D");
+    }
+
+    {
+        // a tile covering the grid is row-major order
+        const supl::fr::iota_nd<2> tiled {{3, 4}, {0, 100}};
+        results.enforce_exactly_equal(
+          tiled.tile(), std::array<std::size_t, 2> {1, 4}, "Tile clamped"
+        );
+        results.enforce_exactly_equal(
+          to_vector(supl::fr::iota_nd<2> {{3, 4}, {3, 4}}),
+          to_vector(supl::fr::iota_nd<2> {{3, 4}}), "Whole grid tile"
+        );
+    }
+}
+
+static void test_chunk(supl::test_results& results)
+{
+    const supl::fr::iota_nd<2> range {{9, 11}, {4, 4}};
+    const auto expected {to_vector(range)};
+
+    for ( const std::size_t chunk_count : {1UL, 2UL, 3UL, 7UL, 200UL} )
+    {
+        const std::string message {
+          "Chunk count " + std::to_string(chunk_count)};
+
+        std::vector<index_2d> joined;
+        std::vector<index_2d> visited;
+        std::size_t smallest {range.size()};
+        std::size_t largest {0};
+
+        for ( std::size_t chunk {0}; chunk != chunk_count; ++chunk )
+        {
+            const auto part {range.chunk(chunk_count, chunk)};
+            smallest = std::min(smallest, part.size());
+            largest  = std::max(largest, part.size());
+            joined.insert(joined.end(), part.begin(), part.end());
+
+            // chunk ends fall inside tiles,
+            // which `for_each` visits by iterator
+            supl::fr::for_each(
+              part,
+              [&visited](const index_2d& index)
+              {
+                  visited.push_back(index);
+              }
+            );
+        }
+
+        results.enforce_exactly_equal(joined, expected, message);
+        results.enforce_exactly_equal(
+          visited, expected, message + " for_each"
+        );
+        results.enforce_true(largest - smallest <= 1, message + " balance");
+    }
+
+    // chunks of chunks
+    const auto part {range.chunk(3, 1)};
+    std::vector<index_2d> joined;
+    for ( std::size_t chunk {0}; chunk != 4; ++chunk )
+    {
+        const auto sub_part {part.chunk(4, chunk)};
+        joined.insert(joined.end(), sub_part.begin(), sub_part.end());
+    }
+    results.enforce_exactly_equal(joined, to_vector(part), "Nested chunk");
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_row_major(results);
+    test_tiled(results);
+    test_chunk(results);
+
+    {
+        constexpr static supl::fr::iota_nd<3> range {{2, 3, 4}, {1, 2, 2}};
+        static_assert(range.size() == 24);
+        static_assert(range.begin()[0] == index_3d {0, 0, 0});
+        static_assert(range.begin()[2] == index_3d {0, 1, 0});
+        static_assert(*(range.end() - 1) == index_3d {1, 2, 3});
+        static_assert(range.chunk(2, 1).size() == 12);
+
+        constexpr static std::size_t sum {[]()
+                                          {
+                                              std::size_t result {0};
+                                              for ( const auto& [i, j, k] :
+                                                    range )
+                                              {
+                                                  result += i * j * k;
+                                              }
+                                              return result;
+                                          }()};
+        static_assert(sum == 18);
+    }
+
+    return results.print_and_return();
+}
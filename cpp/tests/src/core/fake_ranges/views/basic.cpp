@@ -0,0 +1,234 @@
+#include <array>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/test_results.hpp"
+
+template <typename Range>
+static auto to_vector(const Range& range)
+{
+    using value_type = supl::remove_cvref_t<decltype(*std::begin(range))>;
+    return std::vector<value_type>(std::begin(range), std::end(range));
+}
+
+constexpr static auto is_even(const int value) -> bool
+{
+    return value % 2 == 0;
+}
+
+constexpr static auto square(const int value) -> int
+{
+    return value * value;
+}
+
+static void test_filter(supl::test_results& results)
+{
+    const std::vector<int> input {1, 2, 3, 4, 5, 6, 7, 8};
+    const std::list<int> list_input(input.begin(), input.end());
+
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::filter(input, is_even)),
+      std::vector {2, 4, 6, 8}, "filter"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::filter(list_input, is_even)),
+      std::vector {2, 4, 6, 8}, "filter over list"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::filter(
+        input,
+        [](const int value)
+        {
+            return value > 100;
+        }
+      )),
+      std::vector<int> {}, "filter of nothing"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::filter(std::vector<int> {}, is_even)),
+      std::vector<int> {}, "filter of empty"
+    );
+
+    static_assert(std::is_same_v<
+                  std::iterator_traits<decltype(supl::fr::filter(
+                    input, is_even
+                  ))::iterator>::iterator_category,
+                  std::forward_iterator_tag>);
+
+    // the view refers to an lvalue, so sees changes to it
+    std::vector<int> mutable_input {1, 2, 3};
+    const auto view {supl::fr::filter(mutable_input, is_even)};
+    mutable_input.push_back(4);
+    results.enforce_exactly_equal(
+      to_vector(view), std::vector {2, 4}, "filter refers to lvalue"
+    );
+
+    // elements of a view over a mutable range can be written through
+    std::vector<int> writable {1, 2, 3, 4};
+    for ( int& value : supl::fr::filter(writable, is_even) )
+    {
+        value = 0;
+    }
+    results.enforce_exactly_equal(
+      writable, std::vector {1, 0, 3, 0}, "filter writes through"
+    );
+}
+
+static void test_transform(supl::test_results& results)
+{
+    const std::vector<int> input {1, 2, 3, 4};
+    const std::list<int> list_input(input.begin(), input.end());
+
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::transform(input, square)),
+      std::vector {1, 4, 9, 16}, "transform"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::transform(
+        list_input,
+        [](const int value)
+        {
+            return std::to_string(value);
+        }
+      )),
+      std::vector<std::string> {"1", "2", "3", "4"},
+      "transform over list to another type"
+    );
+
+    // forward iterators must yield references,
+    // so transforms returning by value are only input iterators,
+    // though they keep the traversal operators of their range
+    const auto view {supl::fr::transform(input, square)};
+    static_assert(std::is_same_v<
+                  std::iterator_traits<
+                    decltype(view)::iterator>::iterator_category,
+                  std::input_iterator_tag>);
+    static_assert(std::is_same_v<
+                  std::iterator_traits<decltype(supl::fr::transform(
+                    list_input, square
+                  ))::iterator>::iterator_category,
+                  std::input_iterator_tag>);
+
+    // transforms returning references keep the category of their range
+    const std::vector<std::pair<int, char>> pairs {
+      {1, 'a'},
+      {2, 'b'},
+      {3, 'c'}
+    };
+    const std::list<std::pair<int, char>> list_pairs(
+      pairs.begin(), pairs.end()
+    );
+    const auto project_first {
+      [](const std::pair<int, char>& pair) -> const int&
+      {
+          return pair.first;
+      }};
+    const auto projection {supl::fr::transform(pairs, project_first)};
+    static_assert(std::is_same_v<
+                  std::iterator_traits<
+                    decltype(projection)::iterator>::iterator_category,
+                  std::random_access_iterator_tag>);
+    static_assert(std::is_same_v<
+                  std::iterator_traits<decltype(supl::fr::transform(
+                    list_pairs, project_first
+                  ))::iterator>::iterator_category,
+                  std::bidirectional_iterator_tag>);
+    results.enforce_exactly_equal(
+      &*std::next(projection.begin()), &pairs[1].first,
+      "transform refers into range"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::take(supl::fr::drop(view, 1), 2)),
+      std::vector {4, 9}, "take and drop over transform by value"
+    );
+
+    results.enforce_exactly_equal(view.begin()[2], 9, "transform []");
+    results.enforce_exactly_equal(*(view.end() - 1), 16, "transform -");
+    results.enforce_exactly_equal(
+      view.end() - view.begin(), std::ptrdiff_t {4}, "transform distance"
+    );
+    results.enforce_true(view.begin() < view.end(), "transform <");
+}
+
+static void test_take_drop(supl::test_results& results)
+{
+    const std::vector<int> input {1, 2, 3, 4, 5};
+    const std::list<int> list_input(input.begin(), input.end());
+    const std::forward_list<int> forward_input(input.begin(), input.end());
+
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::take(input, 3)), std::vector {1, 2, 3}, "take"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::take(input, 10)), input, "take more than size"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::take(input, 0)), std::vector<int> {}, "take none"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::take(list_input, 3)), std::vector {1, 2, 3},
+      "take over list"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::take(forward_input, 10)), input,
+      "take more than size over forward_list"
+    );
+
+    // random access ranges take their own iterators
+    static_assert(std::is_same_v<
+                  decltype(supl::fr::take(input, 3))::iterator,
+                  std::vector<int>::const_iterator>);
+
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::drop(input, 2)), std::vector {3, 4, 5}, "drop"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::drop(input, 10)), std::vector<int> {},
+      "drop more than size"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::drop(forward_input, 3)), std::vector {4, 5},
+      "drop over forward_list"
+    );
+    results.enforce_exactly_equal(
+      to_vector(supl::fr::drop(forward_input, 30)), std::vector<int> {},
+      "drop more than size over forward_list"
+    );
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    test_filter(results);
+    test_transform(results);
+    test_take_drop(results);
+
+    {
+        constexpr static std::array input {1, 2, 3, 4, 5, 6};
+        constexpr static int sum {[]()
+                                  {
+                                      int result {0};
+                                      for ( const int value :
+                                            supl::fr::transform(
+                                              supl::fr::filter(
+                                                input, is_even
+                                              ),
+                                              square
+                                            ) )
+                                      {
+                                          result += value;
+                                      }
+                                      return result;
+                                  }()};
+        static_assert(sum == 4 + 16 + 36);
+    }
+
+    return results.print_and_return();
+}
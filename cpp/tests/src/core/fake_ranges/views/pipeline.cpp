@@ -0,0 +1,216 @@
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    std::vector<int> input(100);
+    for ( std::size_t i {0}; i != input.size(); ++i )
+    {
+        input[i] = static_cast<int>(i);
+    }
+
+    {
+        // every stage runs once per element, in a single pass
+        std::size_t pred_calls {0};
+        std::size_t func_calls {0};
+        std::vector<int> visited;
+
+        supl::fr::for_each(
+          supl::fr::transform(
+            supl::fr::filter(
+              input,
+              [&pred_calls](const int value)
+              {
+                  ++pred_calls;
+                  return value % 3 == 0;
+              }
+            ),
+            [&func_calls](const int value)
+            {
+                ++func_calls;
+                return value * 10;
+            }
+          ),
+          [&visited](const int value)
+          {
+              visited.push_back(value);
+          }
+        );
+
+        std::vector<int> expected;
+        for ( int i {0}; i < 100; i += 3 )
+        {
+            expected.push_back(i * 10);
+        }
+
+        results.enforce_exactly_equal(visited, expected, "Fused pipeline");
+        results.enforce_exactly_equal(
+          pred_calls, std::size_t {100}, "Predicate called once each"
+        );
+        results.enforce_exactly_equal(
+          func_calls, expected.size(), "Function called once each"
+        );
+    }
+
+    {
+        // `take` stops pulling from earlier stages once it has enough
+        std::size_t pred_calls {0};
+        std::vector<int> visited;
+
+        supl::fr::for_each(
+          supl::fr::take(
+            supl::fr::filter(
+              input,
+              [&pred_calls](const int value)
+              {
+                  ++pred_calls;
+                  return value % 2 == 1;
+              }
+            ),
+            3
+          ),
+          [&visited](const int value)
+          {
+              visited.push_back(value);
+          }
+        );
+
+        results.enforce_exactly_equal(
+          visited, std::vector {1, 3, 5}, "take after filter"
+        );
+        results.enforce_exactly_equal(
+          pred_calls, std::size_t {6}, "take stops at the last element"
+        );
+    }
+
+    {
+        const auto pipeline {supl::fr::take(
+          supl::fr::drop(
+            supl::fr::transform(
+              input,
+              [](const int value)
+              {
+                  return value * value;
+              }
+            ),
+            5
+          ),
+          3
+        )};
+
+        results.enforce_exactly_equal(
+          std::vector<int>(pipeline.begin(), pipeline.end()),
+          std::vector {25, 36, 49}, "drop then take of transform"
+        );
+        results.enforce_exactly_equal(
+          supl::fr::count_if(
+            pipeline,
+            [](const int value)
+            {
+                return value > 30;
+            }
+          ),
+          std::ptrdiff_t {2}, "count_if over a view"
+        );
+        results.enforce_true(
+          supl::fr::all_of(
+            pipeline,
+            [](const int value)
+            {
+                return value >= 25;
+            }
+          ),
+          "all_of over a view"
+        );
+    }
+
+    {
+        // views own rvalue ranges, including other views
+        const auto owning {supl::fr::filter(
+          std::list<std::string> {"a", "bb", "ccc", "dd"},
+          [](const std::string& value)
+          {
+              return value.size() == 2;
+          }
+        )};
+
+        std::string joined;
+        supl::fr::for_each(
+          owning,
+          [&joined](const std::string& value)
+          {
+              joined += value;
+          }
+        );
+        results.enforce_exactly_equal(
+          joined, std::string {"bbdd"}, "Owned range"
+        );
+    }
+
+    {
+        // stages compose with the other fake ranges
+        int sum {0};
+        supl::fr::for_each(
+          supl::fr::filter(
+            supl::fr::iota<int> {0, 10},
+            [](const int value)
+            {
+                return value % 2 == 0;
+            }
+          ),
+          [&sum](const int value)
+          {
+              sum += value;
+          }
+        );
+        results.enforce_exactly_equal(sum, 20, "Filter over iota");
+
+        std::size_t diagonal {0};
+        supl::fr::for_each(
+          supl::fr::filter(
+            supl::fr::iota_nd<2> {{6, 6}, {4, 4}},
+            [](const auto& index)
+            {
+                return std::get<0>(index) == std::get<1>(index);
+            }
+          ),
+          [&diagonal](const auto& /*unused*/)
+          {
+              ++diagonal;
+          }
+        );
+        results.enforce_exactly_equal(
+          diagonal, std::size_t {6}, "Filter over iota_nd"
+        );
+
+        const std::vector<int> values {1, 2, 3, 4};
+        const supl::any_range<const int> erased {values};
+        int erased_sum {0};
+        supl::fr::for_each(
+          supl::fr::transform(
+            erased,
+            [](const int value)
+            {
+                return value * 2;
+            }
+          ),
+          [&erased_sum](const int value)
+          {
+              erased_sum += value;
+          }
+        );
+        results.enforce_exactly_equal(
+          erased_sum, 20, "Transform over any_range"
+        );
+    }
+
+    return results.print_and_return();
+}
@@ -0,0 +1,288 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <map>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "supl/fake_ranges.hpp"
+#include "supl/iterators.hpp"
+#include "supl/utility.hpp"
+#include "supl/test_results.hpp"
+
+namespace
+{
+std::size_t allocation_count {0};  // NOLINT(*non-const-global*)
+
+// Iterator too large for the small buffer
+struct big_iterator
+{
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = int*;
+    using reference         = int&;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    int* ptr;
+    std::array<std::byte, 64> padding {};
+
+    auto operator++() -> big_iterator&
+    {
+        ++ptr;
+        return *this;
+    }
+
+    auto operator--() -> big_iterator&
+    {
+        --ptr;
+        return *this;
+    }
+
+    auto operator*() const -> int&
+    {
+        return *ptr;
+    }
+
+    auto operator==(const big_iterator& rhs) const -> bool
+    {
+        return ptr == rhs.ptr;
+    }
+
+    auto operator!=(const big_iterator& rhs) const -> bool
+    {
+        return ptr != rhs.ptr;
+    }
+};
+}  // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocation_count;
+    if ( void* ptr {std::malloc(size)}; ptr != nullptr )  // NOLINT
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);  // NOLINT
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);  // NOLINT
+}
+
+static auto sum_of(const supl::any_range<const int>& range) -> int
+{
+    int sum {0};
+    range.for_each(
+      [&sum](const int value)
+      {
+          sum += value;
+      }
+    );
+    return sum;
+}
+
+template <typename Container>
+static void enforce_range(
+  supl::test_results& results, const Container& container,
+  const std::optional<std::size_t> expected_size, const char* message
+)
+{
+    const std::size_t before {allocation_count};
+
+    const supl::any_range range {container};
+    const supl::any_range copy {range};
+    supl::any_range moved {std::move(copy)};
+    moved = range;
+
+    results.enforce_exactly_equal(
+      allocation_count - before, std::size_t {0}, message
+    );
+    results.enforce_exactly_equal(range.is_small_buffered(), true, message);
+
+    results.enforce_exactly_equal(sum_of(range), 15, message);
+    results.enforce_exactly_equal(sum_of(moved), 15, message);
+    results.enforce_equal(range.size(), expected_size, message);
+    results.enforce_exactly_equal(range.empty(), false, message);
+
+    int sum {0};
+    for ( const int value : range )
+    {
+        sum += value;
+    }
+    results.enforce_exactly_equal(sum, 15, message);
+
+    results.enforce_exactly_equal(
+      supl::to_string(range), std::string {"[ 1, 2, 3, 4, 5 ]"}, message
+    );
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    const std::vector<int> vec {1, 2, 3, 4, 5};
+    const std::deque<int> deque {1, 2, 3, 4, 5};
+    const std::list<int> list {1, 2, 3, 4, 5};
+
+    enforce_range(results, vec, 5, "vector");
+    enforce_range(results, deque, 5, "deque");
+    enforce_range(results, list, 5, "list");
+    enforce_range(results, supl::fr::iota<int> {1, 6}, 5, "iota");
+
+    // iterator pair
+    const supl::any_range random_access_pair {vec.begin(), vec.end()};
+    results.enforce_equal(
+      random_access_pair.size(), std::optional<std::size_t> {5}
+    );
+    const supl::any_range bidirectional_pair {list.begin(), list.end()};
+    results.enforce_equal(
+      bidirectional_pair.size(), std::optional<std::size_t> {}
+    );
+    results.enforce_exactly_equal(sum_of(bidirectional_pair), 15);
+
+    // implicit conversion from containers
+    results.enforce_exactly_equal(sum_of(vec), 15);
+    results.enforce_exactly_equal(sum_of(list), 15);
+
+    // fake ranges
+    results.enforce_exactly_equal(
+      supl::fr::count(bidirectional_pair, 3), std::ptrdiff_t {1}
+    );
+    results.enforce_exactly_equal(
+      supl::fr::count_if(
+        bidirectional_pair,
+        [](const int value)
+        {
+            return value % 2 == 1;
+        }
+      ),
+      std::ptrdiff_t {3}
+    );
+    results.enforce_exactly_equal(
+      supl::fr::all_of(
+        bidirectional_pair,
+        [](const int value)
+        {
+            return value > 0;
+        }
+      ),
+      true
+    );
+
+    int fr_sum {0};
+    supl::fr::for_each(
+      bidirectional_pair,
+      [&fr_sum](const int value)
+      {
+          fr_sum += value;
+      }
+    );
+    results.enforce_exactly_equal(fr_sum, 15);
+
+    // non-const elements may be modified
+    std::list<int> mutable_list {1, 2, 3};
+    const supl::any_range<int> mutable_range {mutable_list};
+    supl::fr::for_each(
+      mutable_range,
+      [](int& value)
+      {
+          value *= 2;
+      }
+    );
+    results.enforce_equal(mutable_list, std::list<int> {2, 4, 6});
+
+    // maps erase to their value type
+    const std::map<int, int> map {
+      {1, 10},
+      {2, 20}
+    };
+    const supl::any_range map_range {map};
+    int mapped_sum {0};
+    map_range.for_each(
+      [&mapped_sum](const std::pair<const int, int>& value)
+      {
+          mapped_sum += value.second;
+      }
+    );
+    results.enforce_exactly_equal(mapped_sum, 30);
+
+    // empty ranges
+    const std::vector<int> empty_vec {};
+    const supl::any_range empty_range {empty_vec};
+    results.enforce_exactly_equal(empty_range.empty(), true);
+    results.enforce_exactly_equal(
+      supl::to_string(empty_range), std::string {"[ ]"}
+    );
+    const supl::any_range empty_list_range {list.end(), list.end()};
+    results.enforce_exactly_equal(empty_list_range.empty(), true);
+
+    // heap fallback
+    std::vector<int> big_vec {1, 2, 3, 4, 5};
+    supl::any_range<int> big {
+      big_iterator {big_vec.data()},
+      big_iterator {big_vec.data() + big_vec.size()}};
+    results.enforce_exactly_equal(big.is_small_buffered(), false);
+
+    const std::size_t before_big_copy {allocation_count};
+    const supl::any_range<int> big_copy {big};
+    results.enforce_exactly_equal(
+      allocation_count - before_big_copy, std::size_t {1},
+      "heap fallback copy"
+    );
+    results.enforce_exactly_equal(sum_of(big_copy), 15);
+
+    supl::any_range<int> big_moved {std::move(big)};
+    results.enforce_exactly_equal(big_moved.is_small_buffered(), false);
+    results.enforce_exactly_equal(big.is_null(), true);  // NOLINT
+
+    // null range
+    const supl::any_range<int> null_range {};
+    results.enforce_exactly_equal(null_range.is_null(), true);
+    results.enforce_equal(null_range.size(), std::optional<std::size_t> {});
+
+    bool threw {false};
+    try
+    {
+        static_cast<void>(null_range.begin());
+    }
+    catch ( const supl::bad_iterator_access& )
+    {
+        threw = true;
+    }
+    results.enforce_exactly_equal(threw, true);
+
+    // temporaries would leave the range dangling,
+    // unless their iterators do not refer into them
+    static_assert(
+      std::is_constructible_v<supl::any_range<int>, std::vector<int>&>
+    );
+    static_assert(
+      not std::is_constructible_v<supl::any_range<int>, std::vector<int>>
+    );
+    static_assert(not std::is_constructible_v<
+                  supl::any_range<const int>, const std::vector<int>>);
+    static_assert(std::is_constructible_v<
+                  supl::any_range<const int>, supl::fr::iota<int>>);
+
+    using namespace std::string_view_literals;
+    const supl::any_range<const char> chars {"abc"sv};
+    results.enforce_exactly_equal(
+      std::string(chars.begin(), chars.end()), std::string {"abc"},
+      "string_view temporary"
+    );
+
+    return results.print_and_return();
+}
@@ -0,0 +1,252 @@
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+static_assert(supl::is_contiguous_iterator_v<int*>);
+static_assert(supl::is_contiguous_iterator_v<const int*>);
+static_assert(supl::is_contiguous_iterator_v<std::vector<int>::iterator>);
+static_assert(supl::is_contiguous_iterator_v<
+              std::vector<double>::const_iterator>);
+static_assert(supl::is_contiguous_iterator_v<std::string::iterator>);
+static_assert(supl::is_contiguous_iterator_v<std::string_view::iterator>);
+static_assert(not supl::is_contiguous_iterator_v<
+              std::vector<bool>::iterator>);
+static_assert(not supl::is_contiguous_iterator_v<std::deque<int>::iterator>
+);
+static_assert(not supl::is_contiguous_iterator_v<std::list<int>::iterator>
+);
+static_assert(not supl::is_contiguous_iterator_v<int>);
+
+// A forward iterator whose `value_type` is `const`,
+// for which no container may be instantiated
+class const_value_iterator
+{
+private:
+
+    const int* m_ptr {nullptr};
+
+public:
+
+    using value_type        = const int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const int*;
+    using reference         = const int&;
+    using iterator_category = std::forward_iterator_tag;
+
+    const_value_iterator() = default;
+
+    explicit const_value_iterator(const int* ptr) noexcept
+            : m_ptr {ptr}
+    {}
+
+    [[nodiscard]] auto operator*() const noexcept -> reference
+    {
+        return *m_ptr;
+    }
+
+    auto operator++() noexcept -> const_value_iterator&
+    {
+        ++m_ptr;
+        return *this;
+    }
+
+    auto operator++(int) noexcept -> const_value_iterator
+    {
+        const_value_iterator copy {*this};
+        ++m_ptr;
+        return copy;
+    }
+
+    [[nodiscard]] auto operator==(const const_value_iterator& rhs
+    ) const noexcept -> bool
+    {
+        return m_ptr == rhs.m_ptr;
+    }
+
+    [[nodiscard]] auto operator!=(const const_value_iterator& rhs
+    ) const noexcept -> bool
+    {
+        return m_ptr != rhs.m_ptr;
+    }
+};
+
+static_assert(not supl::is_contiguous_iterator_v<const_value_iterator>);
+
+static_assert(supl::is_erased_iterator_v<supl::iterator<int>>);
+static_assert(supl::is_erased_iterator_v<
+              supl::iterator<int, std::random_access_iterator_tag>>);
+static_assert(not supl::is_erased_iterator_v<int*>);
+
+// only iterators where indexing beats incrementing are indexed
+static_assert(supl::impl::is_indexable_v<int*>);
+static_assert(supl::impl::is_indexable_v<std::vector<int>::iterator>);
+static_assert(supl::impl::is_indexable_v<
+              supl::iterator<int, std::random_access_iterator_tag>>);
+static_assert(not supl::impl::is_indexable_v<supl::iterator<int>>);
+static_assert(not supl::impl::is_indexable_v<std::deque<int>::iterator>);
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    std::vector<int> vec {1, 2, 3, 4, 5};
+    const std::deque<int> deque {1, 2, 3, 4, 5};
+    const std::list<int> list {1, 2, 3, 4, 5};
+    const std::string str {"hello"};
+
+    // spans
+    const supl::iterator vec_begin {vec.begin()};
+    const supl::iterator vec_end {vec.end()};
+    const auto vec_span {vec_begin.contiguous_span(vec_end)};
+    results.enforce_exactly_equal(vec_span.has_value(), true, "vector");
+    results.enforce_exactly_equal(vec_span->first, vec.data());
+    results.enforce_exactly_equal(vec_span->second, vec.data() + 5);
+
+    const supl::iterator ptr_begin {vec.data() + 1};
+    const supl::iterator ptr_end {vec.data() + 3};
+    const auto ptr_span {ptr_begin.contiguous_span(ptr_end)};
+    results.enforce_exactly_equal(ptr_span.has_value(), true, "pointer");
+    results.enforce_exactly_equal(ptr_span->first, vec.data() + 1);
+    results.enforce_exactly_equal(ptr_span->second, vec.data() + 3);
+
+    const supl::iterator str_begin {str.begin()};
+    const supl::iterator str_end {str.end()};
+    results.enforce_exactly_equal(
+      str_begin.contiguous_span(str_end).has_value(), true, "string"
+    );
+
+    const auto empty_span {vec_end.contiguous_span(vec_end)};
+    results.enforce_exactly_equal(empty_span.has_value(), true, "empty");
+    results.enforce_exactly_equal(empty_span->first, empty_span->second);
+
+    const supl::iterator deque_begin {deque.begin()};
+    const supl::iterator deque_end {deque.end()};
+    results.enforce_exactly_equal(
+      deque_begin.contiguous_span(deque_end).has_value(), false, "deque"
+    );
+
+    // mismatched erased types
+    const supl::iterator<int> vec_itr_end {vec.end()};
+    const supl::iterator<int> ptr_as_end {vec.data() + 5};
+    results.enforce_exactly_equal(
+      supl::iterator<int> {vec.begin()}
+        .contiguous_span(ptr_as_end)
+        .has_value(),
+      false, "mismatched"
+    );
+
+    // algorithms agree on contiguous and non-contiguous erased ranges
+    const supl::iterator list_begin {list.begin()};
+    const supl::iterator list_end {list.end()};
+
+    int vec_sum {0};
+    int list_sum {0};
+    supl::for_each(
+      vec_begin, vec_itr_end,
+      [&vec_sum](const int value)
+      {
+          vec_sum += value;
+      }
+    );
+    supl::for_each(
+      list_begin, list_end,
+      [&list_sum](const int value)
+      {
+          list_sum += value;
+      }
+    );
+    results.enforce_exactly_equal(vec_sum, 15, "for_each");
+    results.enforce_exactly_equal(list_sum, 15, "for_each");
+
+    // for_each may mutate through a non-const erased iterator
+    supl::for_each(
+      vec_begin, vec_end,
+      [](int& value)
+      {
+          value *= 2;
+      }
+    );
+    results.enforce_equal(vec, std::vector {2, 4, 6, 8, 10});
+
+    std::vector<int> transformed;
+    supl::transform(
+      vec_begin, vec_end, std::back_inserter(transformed),
+      [](const int value)
+      {
+          return value + 1;
+      }
+    );
+    results.enforce_equal(transformed, std::vector {3, 5, 7, 9, 11});
+
+    std::array<int, 5> copied {};
+    const auto copy_end {
+      supl::copy(deque_begin, deque_end, copied.begin())
+    };
+    results.enforce_equal(copied, std::array {1, 2, 3, 4, 5});
+    results.enforce_exactly_equal(copy_end, copied.end());
+
+    std::array<int, 5> copied_contiguous {};
+    const auto copy_contiguous_end {
+      supl::copy(vec_begin, vec_end, copied_contiguous.begin())
+    };
+    results.enforce_equal(copied_contiguous, std::array {2, 4, 6, 8, 10});
+    results.enforce_exactly_equal(
+      copy_contiguous_end, copied_contiguous.end()
+    );
+
+    results.enforce_exactly_equal(
+      supl::contains(vec_begin, vec_end, 6), true
+    );
+    results.enforce_exactly_equal(
+      supl::contains(vec_begin, vec_end, 5), false
+    );
+    results.enforce_exactly_equal(
+      supl::contains(list_begin, list_end, 5), true
+    );
+    results.enforce_exactly_equal(
+      supl::contains(str_begin, str_end, 'l'), true
+    );
+
+    // algorithms accept iterators with a `const` value type
+    const std::array<int, 5> values {1, 2, 3, 4, 5};
+    const const_value_iterator const_begin {values.data()};
+    const const_value_iterator const_end {values.data() + values.size()};
+
+    results.enforce_exactly_equal(
+      supl::contains(const_begin, const_end, 4), true, "const value_type"
+    );
+
+    std::array<int, 5> const_copied {};
+    supl::copy(const_begin, const_end, const_copied.begin());
+    results.enforce_equal(const_copied, values, "const value_type");
+
+    std::array<int, 3> const_copied_n {};
+    supl::copy_n(const_begin, const_copied_n.size(), const_copied_n.begin());
+    results.enforce_equal(
+      const_copied_n, std::array {1, 2, 3}, "const value_type"
+    );
+
+    int const_sum {0};
+    supl::for_each_block<2>(
+      const_begin, const_end,
+      [&const_sum](const int* data, const std::size_t count)
+      {
+          for ( std::size_t i {0}; i != count; ++i )
+          {
+              const_sum += data[i];
+          }
+      }
+    );
+    results.enforce_exactly_equal(const_sum, 15, "const value_type");
+
+    return results.print_and_return();
+}
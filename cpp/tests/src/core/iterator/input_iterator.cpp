@@ -0,0 +1,150 @@
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+namespace
+{
+// Move-only generator of the integers [0, limit)
+class counting_generator
+{
+private:
+
+    std::unique_ptr<int> m_state;
+    int m_limit {0};
+
+public:
+
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const int*;
+    using reference         = const int&;
+    using iterator_category = std::input_iterator_tag;
+
+    // sentinel
+    counting_generator() = default;
+
+    explicit counting_generator(const int limit)
+            : m_state {std::make_unique<int>(0)}
+            , m_limit {limit}
+    {
+    }
+
+    auto operator++() -> counting_generator&
+    {
+        if ( ++*m_state == m_limit )
+        {
+            m_state.reset();
+        }
+        return *this;
+    }
+
+    auto operator*() const -> const int&
+    {
+        return *m_state;
+    }
+
+    auto operator==(const counting_generator& rhs) const -> bool
+    {
+        return (m_state == nullptr) == (rhs.m_state == nullptr);
+    }
+};
+}  // namespace
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    // stream input
+    std::istringstream stream {"1 2 3 4 5"};
+    supl::input_iterator begin {std::istream_iterator<int> {stream}};
+    supl::input_iterator end {std::istream_iterator<int> {}};
+
+    results.enforce_exactly_equal(begin.is_small_buffered(), true);
+    results.enforce_exactly_equal(*begin, 1);
+    ++begin;
+    begin++;
+    results.enforce_exactly_equal(*begin, 3);
+    results.enforce_exactly_equal(begin != end, true);
+
+    int sum {0};
+    supl::for_each(
+      std::move(begin), std::move(end),
+      [&sum](const int value)
+      {
+          sum += value;
+      }
+    );
+    results.enforce_exactly_equal(sum, 12);
+
+    // move-only generator
+    std::vector<int> transformed;
+    supl::transform(
+      supl::input_iterator<const int> {counting_generator {5}},
+      supl::input_iterator<const int> {counting_generator {}},
+      std::back_inserter(transformed),
+      [](const int value)
+      {
+          return value * 2;
+      }
+    );
+    results.enforce_equal(transformed, std::vector {0, 2, 4, 6, 8});
+
+    // block-wise consumption
+    std::vector<std::size_t> block_sizes;
+    int block_sum {0};
+    supl::for_each_block<4>(
+      supl::input_iterator<const int> {counting_generator {10}},
+      supl::input_iterator<const int> {counting_generator {}},
+      [&block_sizes, &block_sum](const int* data, const std::size_t count)
+      {
+          block_sizes.push_back(count);
+          for ( std::size_t i {0}; i != count; ++i )
+          {
+              block_sum += data[i];
+          }
+      }
+    );
+    results.enforce_equal(block_sizes, std::vector<std::size_t> {4, 4, 2});
+    results.enforce_exactly_equal(block_sum, 45);
+
+    // arrow operator
+    std::istringstream words {"alpha beta"};
+    supl::input_iterator word {std::istream_iterator<std::string> {words}};
+    results.enforce_exactly_equal(word->size(), std::size_t {5});
+
+    // moving
+    supl::input_iterator moved {std::move(word)};
+    results.enforce_exactly_equal(word.is_null(), true);  // NOLINT
+    ++moved;
+    results.enforce_exactly_equal(*moved, std::string {"beta"});
+
+    // different erased types compare unequal
+    std::istringstream other {"1"};
+    const supl::input_iterator<const int> stream_itr {
+      std::istream_iterator<int> {other}};
+    const supl::input_iterator<const int> generator_itr {
+      counting_generator {1}};
+    results.enforce_exactly_equal(stream_itr == generator_itr, false);
+
+    // null
+    const supl::input_iterator<const int> null_itr {};
+    bool threw {false};
+    try
+    {
+        [[maybe_unused]] auto illegal {*null_itr};
+    }
+    catch ( supl::bad_iterator_access& )
+    {
+        threw = true;
+    }
+    results.enforce_exactly_equal(threw, true, "null dereference");
+
+    return results.print_and_return();
+}
@@ -0,0 +1,184 @@
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <memory_resource>
+#include <vector>
+
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+namespace
+{
+// Forwards to an upstream resource, counting outstanding allocations
+class counting_resource : public std::pmr::memory_resource
+{
+private:
+
+    std::pmr::memory_resource* m_upstream;
+
+public:
+
+    std::size_t allocations {0};    // NOLINT(*non-private-member*)
+    std::size_t deallocations {0};  // NOLINT(*non-private-member*)
+
+    explicit counting_resource(std::pmr::memory_resource* upstream)
+            : m_upstream {upstream}
+    {
+    }
+
+private:
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+      -> void* override
+    {
+        ++allocations;
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+      override
+    {
+        ++deallocations;
+        m_upstream->deallocate(ptr, bytes, alignment);
+    }
+
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other
+    ) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+// Iterator too large for the small buffer
+struct big_iterator
+{
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = int*;
+    using reference         = int&;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    int* ptr;
+    std::array<std::byte, 64> padding {};
+
+    auto operator++() -> big_iterator&
+    {
+        ++ptr;
+        return *this;
+    }
+
+    auto operator--() -> big_iterator&
+    {
+        --ptr;
+        return *this;
+    }
+
+    auto operator*() const -> int&
+    {
+        return *ptr;
+    }
+
+    auto operator==(const big_iterator& rhs) const -> bool
+    {
+        return ptr == rhs.ptr;
+    }
+};
+}  // namespace
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    std::vector<int> vec {1, 2, 3, 4, 5};
+    counting_resource counter {std::pmr::new_delete_resource()};
+
+    {
+        const supl::iterator<int> big {big_iterator {vec.data()}, &counter};
+        results.enforce_exactly_equal(big.is_small_buffered(), false);
+        results.enforce_exactly_equal(
+          big.resource(), static_cast<std::pmr::memory_resource*>(&counter)
+        );
+        results.enforce_exactly_equal(
+          counter.allocations, std::size_t {1}, "construction"
+        );
+
+        // copies propagate the resource
+        supl::iterator<int> copy {big};
+        results.enforce_exactly_equal(copy.resource(), big.resource());
+        results.enforce_exactly_equal(
+          counter.allocations, std::size_t {2}, "copy"
+        );
+
+        ++copy;
+        results.enforce_exactly_equal(*copy, 2);
+        results.enforce_exactly_equal(*big, 1);
+
+        // moving a heap model does not allocate
+        const supl::iterator<int> moved {std::move(copy)};
+        results.enforce_exactly_equal(moved.resource(), big.resource());
+        results.enforce_exactly_equal(
+          counter.allocations, std::size_t {2}, "move"
+        );
+        results.enforce_exactly_equal(*moved, 2);
+
+        // copy assignment adopts the resource of the source
+        supl::iterator<int> assigned {vec.begin()};
+        assigned = big;
+        results.enforce_exactly_equal(assigned.resource(), big.resource());
+        results.enforce_exactly_equal(
+          counter.allocations, std::size_t {3}, "copy assignment"
+        );
+
+        // assigning an erased iterator keeps the resource
+        assigned = big_iterator {vec.data() + 2};
+        results.enforce_exactly_equal(
+          counter.allocations, std::size_t {4}, "erased assignment"
+        );
+        results.enforce_exactly_equal(
+          counter.deallocations, std::size_t {1}, "erased assignment"
+        );
+        results.enforce_exactly_equal(*assigned, 3);
+    }
+
+    results.enforce_exactly_equal(
+      counter.deallocations, counter.allocations, "all returned"
+    );
+
+    // iterators which fit inline never touch the resource
+    {
+        const std::list<int> list {1, 2, 3};
+        const supl::iterator small {list.begin(), &counter};
+        const supl::iterator small_copy {small};
+        results.enforce_exactly_equal(small_copy.is_small_buffered(), true);
+        results.enforce_exactly_equal(
+          counter.allocations, std::size_t {4}, "inline"
+        );
+    }
+
+    // an arena can back every copy
+    {
+        std::array<std::byte, 4096> arena_buffer {};
+        std::pmr::monotonic_buffer_resource arena {
+          arena_buffer.data(), arena_buffer.size(),
+          std::pmr::null_memory_resource()};
+
+        const supl::iterator<int> begin {big_iterator {vec.data()}, &arena};
+        const supl::iterator<int> end {
+          big_iterator {vec.data() + vec.size()}, &arena};
+
+        int sum {0};
+        for ( supl::iterator<int> itr {begin}; itr != end; itr++ )
+        {
+            sum += *itr;
+        }
+        results.enforce_exactly_equal(sum, 15);
+    }
+
+    const supl::iterator<int> defaulted {big_iterator {vec.data()}};
+    results.enforce_exactly_equal(
+      defaulted.resource(), static_cast<std::pmr::memory_resource*>(nullptr)
+    );
+
+    return results.print_and_return();
+}
@@ -0,0 +1,60 @@
+#include <deque>
+#include <list>
+#include <vector>
+
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    std::vector<int> vec {1, 2, 3};
+    std::deque<int> deque {1, 2, 3};
+    std::list<int> list {1, 2, 3};
+
+    const supl::iterator vec_begin {vec.begin()};
+    supl::iterator vec_itr {vec.begin()};
+    const supl::iterator deque_itr {deque.begin()};
+    const supl::iterator list_itr {list.begin()};
+
+    // same erased type
+    results.enforce_exactly_equal(vec_begin == vec_itr, true);
+    ++vec_itr;
+    results.enforce_exactly_equal(vec_begin == vec_itr, false);
+    results.enforce_exactly_equal(vec_begin != vec_itr, true);
+
+    // different erased type
+    results.enforce_exactly_equal(vec_begin == deque_itr, false);
+    results.enforce_exactly_equal(deque_itr == list_itr, false);
+    results.enforce_exactly_equal(list_itr != vec_begin, true);
+
+    // const and non-const iterators of the same container are distinct types
+    const supl::iterator<const int> const_itr {vec.cbegin()};
+    const supl::iterator<const int> non_const_itr {vec.begin()};
+    results.enforce_exactly_equal(const_itr == non_const_itr, false);
+
+    // null rhs
+    const supl::iterator<int> null_itr {};
+    results.enforce_exactly_equal(vec_begin == null_itr, false);
+
+    // erased type is retained through copy and move
+    const supl::iterator copy {vec_begin};
+    supl::iterator moved {supl::iterator {vec.begin()}};
+    results.enforce_exactly_equal(copy == vec_begin, true);
+    results.enforce_exactly_equal(moved == vec_begin, true);
+
+    moved = deque.begin();
+    results.enforce_exactly_equal(moved == deque_itr, true);
+    results.enforce_exactly_equal(moved == vec_begin, false);
+
+    int sum {0};
+    for ( supl::iterator itr {list.begin()}, end {list.end()}; itr != end;
+          ++itr )
+    {
+        sum += *itr;
+    }
+    results.enforce_exactly_equal(sum, 6);
+
+    return results.print_and_return();
+}
@@ -0,0 +1,152 @@
+#include <array>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+#include "supl/algorithm.hpp"
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+using ra_iterator = supl::iterator<int, std::random_access_iterator_tag>;
+using const_ra_iterator =
+  supl::iterator<const int, std::random_access_iterator_tag>;
+
+static_assert(std::is_same_v<
+              std::iterator_traits<ra_iterator>::iterator_category,
+              std::random_access_iterator_tag>);
+
+static_assert(std::is_same_v<
+              std::iterator_traits<supl::iterator<int>>::iterator_category,
+              std::bidirectional_iterator_tag>);
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    std::vector<int> vec {0, 1, 2, 3, 4, 5, 6, 7};
+    std::deque<int> deque {10, 11, 12, 13};
+
+    ra_iterator begin {vec.begin()};
+    const ra_iterator end {vec.end()};
+
+    results.enforce_exactly_equal(end - begin, std::ptrdiff_t {8});
+    results.enforce_exactly_equal(
+      std::distance(begin, end), std::ptrdiff_t {8}
+    );
+    results.enforce_exactly_equal(begin[5], 5);
+
+    begin += 3;
+    results.enforce_exactly_equal(*begin, 3);
+    begin -= 2;
+    results.enforce_exactly_equal(*begin, 1);
+
+    const ra_iterator plus {begin + 4};
+    const ra_iterator plus_rev {4 + begin};
+    const ra_iterator minus {plus - 2};
+    results.enforce_exactly_equal(*plus, 5);
+    results.enforce_exactly_equal(plus == plus_rev, true);
+    results.enforce_exactly_equal(*minus, 3);
+
+    std::advance(begin, 6);
+    results.enforce_exactly_equal(*begin, 7);
+
+    // relational comparison
+    results.enforce_exactly_equal(minus < plus, true);
+    results.enforce_exactly_equal(plus < minus, false);
+    results.enforce_exactly_equal(plus > minus, true);
+    results.enforce_exactly_equal(plus <= plus_rev, true);
+    results.enforce_exactly_equal(plus >= plus_rev, true);
+    results.enforce_exactly_equal(minus >= plus, false);
+
+    // different erased types are unordered
+    const ra_iterator deque_begin {deque.begin()};
+    results.enforce_exactly_equal(deque_begin < plus, false);
+    results.enforce_exactly_equal(plus < deque_begin, false);
+
+    // writes through subscript
+    ra_iterator writer {vec.begin()};
+    writer[0] = 42;
+    results.enforce_exactly_equal(vec.front(), 42);
+    vec.front() = 0;
+
+    // const tier
+    const const_ra_iterator cbegin {vec.cbegin()};
+    const const_ra_iterator cend {vec.cend()};
+    results.enforce_exactly_equal(cend - cbegin, std::ptrdiff_t {8});
+
+    // n-step algorithms
+    std::array<int, 4> copied {};
+    supl::copy_n(cbegin, 4, copied.begin());
+    results.enforce_equal(copied, std::array {0, 1, 2, 3});
+
+    int both_sum {0};
+    supl::for_each_both_n(
+      cbegin, deque_begin, 4,
+      [&both_sum](const int lhs, const int rhs)
+      {
+          both_sum += lhs * rhs;
+      }
+    );
+    results.enforce_exactly_equal(
+      both_sum, (0 * 10) + (1 * 11) + (2 * 12) + (3 * 13)
+    );
+
+    std::vector<int> zipped;
+    supl::zip_apply_n(
+      [&zipped](const int lhs, const int rhs, const int raw)
+      {
+          zipped.push_back(lhs + rhs + raw);
+      },
+      3, cbegin, deque_begin, vec.data()
+    );
+    results.enforce_equal(zipped, std::vector {10, 13, 16});
+
+    // null
+    const ra_iterator null_itr {};
+    bool threw {false};
+    try
+    {
+        [[maybe_unused]] auto illegal {null_itr[0]};
+    }
+    catch ( supl::bad_iterator_access& )
+    {
+        threw = true;
+    }
+    results.enforce_exactly_equal(threw, true, "null subscript");
+
+    threw = false;
+    try
+    {
+        [[maybe_unused]] auto illegal {plus - null_itr};
+    }
+    catch ( supl::bad_iterator_access& )
+    {
+        threw = true;
+    }
+    results.enforce_exactly_equal(threw, true, "null distance");
+
+    threw = false;
+    try
+    {
+        [[maybe_unused]] auto illegal {null_itr > plus};
+    }
+    catch ( supl::bad_iterator_access& )
+    {
+        threw = true;
+    }
+    results.enforce_exactly_equal(threw, true, "null greater");
+
+    // there is no distance between different erased types
+    threw = false;
+    try
+    {
+        [[maybe_unused]] auto illegal {plus - deque_begin};
+    }
+    catch ( supl::bad_iterator_access& )
+    {
+        threw = true;
+    }
+    results.enforce_exactly_equal(threw, true, "mismatched distance");
+
+    return results.print_and_return();
+}
@@ -0,0 +1,146 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <map>
+#include <new>
+#include <vector>
+
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+namespace
+{
+std::size_t allocation_count {0};  // NOLINT(*non-const-global*)
+
+// Iterator too large for the small buffer
+struct big_iterator
+{
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = int*;
+    using reference         = int&;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    int* ptr;
+    std::array<std::byte, 64> padding {};
+
+    auto operator++() -> big_iterator&
+    {
+        ++ptr;
+        return *this;
+    }
+
+    auto operator--() -> big_iterator&
+    {
+        --ptr;
+        return *this;
+    }
+
+    auto operator*() const -> int&
+    {
+        return *ptr;
+    }
+
+    auto operator==(const big_iterator& rhs) const -> bool
+    {
+        return ptr == rhs.ptr;
+    }
+};
+}  // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocation_count;
+    if ( void* ptr {std::malloc(size)}; ptr != nullptr )  // NOLINT
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);  // NOLINT
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);  // NOLINT
+}
+
+template <typename Itr>
+static void enforce_no_allocations(
+  supl::test_results& results, Itr begin, Itr end, const char* message
+)
+{
+    const std::size_t before {allocation_count};
+
+    supl::iterator erased_begin {begin};
+    const supl::iterator erased_end {end};
+
+    int sum {0};
+    for ( ; erased_begin != erased_end; erased_begin++ )
+    {
+        const supl::iterator copy {erased_begin};
+        sum += *copy;
+    }
+
+    auto moved {std::move(erased_begin)};
+    erased_begin = moved;
+
+    results.enforce_exactly_equal(
+      allocation_count - before, std::size_t {0}, message
+    );
+    results.enforce_exactly_equal(sum, 15, message);
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    std::vector<int> vec {1, 2, 3, 4, 5};
+    const std::deque<int> deque {1, 2, 3, 4, 5};
+    const std::list<int> list {1, 2, 3, 4, 5};
+    std::array<int, 5> arr {1, 2, 3, 4, 5};
+
+    enforce_no_allocations(results, vec.begin(), vec.end(), "vector");
+    enforce_no_allocations(results, deque.begin(), deque.end(), "deque");
+    enforce_no_allocations(results, list.begin(), list.end(), "list");
+    enforce_no_allocations(
+      results, arr.data(), arr.data() + arr.size(), "pointer"
+    );
+
+    const supl::iterator small {vec.begin()};
+    results.enforce_exactly_equal(small.is_small_buffered(), true);
+
+    supl::iterator<int> big {big_iterator {vec.data()}};
+    results.enforce_exactly_equal(big.is_small_buffered(), false);
+
+    const std::size_t before_big_copy {allocation_count};
+    supl::iterator<int> big_copy {big};
+    results.enforce_exactly_equal(
+      allocation_count - before_big_copy, std::size_t {1},
+      "heap fallback copy"
+    );
+
+    ++big_copy;
+    results.enforce_exactly_equal(*big, 1);
+    results.enforce_exactly_equal(*big_copy, 2);
+
+    supl::iterator<int> big_moved {std::move(big_copy)};
+    results.enforce_exactly_equal(*big_moved, 2);
+    results.enforce_exactly_equal(big_copy.is_null(), true);  // NOLINT
+
+    big_moved = vec.begin();
+    results.enforce_exactly_equal(big_moved.is_small_buffered(), true);
+    results.enforce_exactly_equal(*big_moved, 1);
+
+    const supl::iterator<int> null_itr {};
+    const supl::iterator<int> null_copy {null_itr};
+    results.enforce_exactly_equal(null_copy.is_null(), true);
+
+    return results.print_and_return();
+}
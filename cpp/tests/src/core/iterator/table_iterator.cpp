@@ -0,0 +1,159 @@
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "supl/iterators.hpp"
+#include "supl/test_results.hpp"
+
+namespace
+{
+// Iterator too large for the small buffer
+struct big_iterator
+{
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = int*;
+    using reference         = int&;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    int* ptr;
+    std::array<std::byte, 64> padding {};
+
+    auto operator++() -> big_iterator&
+    {
+        ++ptr;
+        return *this;
+    }
+
+    auto operator--() -> big_iterator&
+    {
+        --ptr;
+        return *this;
+    }
+
+    auto operator*() const -> int&
+    {
+        return *ptr;
+    }
+
+    auto operator==(const big_iterator& rhs) const -> bool
+    {
+        return ptr == rhs.ptr;
+    }
+};
+}  // namespace
+
+template <typename Container>
+static void enforce_traversal(
+  supl::test_results& results, const Container& container,
+  const char* message
+)
+{
+    supl::table_iterator begin {container.begin()};
+    const supl::table_iterator end {container.end()};
+
+    results.enforce_exactly_equal(begin.is_small_buffered(), true, message);
+
+    std::vector<int> forward;
+    for ( auto itr {begin}; itr != end; ++itr )
+    {
+        forward.push_back(*itr);
+    }
+    results.enforce_equal(forward, std::vector {1, 2, 3, 4}, message);
+
+    std::vector<int> backward;
+    for ( auto itr {end}; itr != begin; )
+    {
+        backward.push_back(*--itr);
+    }
+    results.enforce_equal(backward, std::vector {4, 3, 2, 1}, message);
+
+    results.enforce_exactly_equal(*begin++, 1, message);
+    results.enforce_exactly_equal(*begin--, 2, message);
+    results.enforce_exactly_equal(*begin, 1, message);
+    results.enforce_exactly_equal(
+      std::distance(begin, end), std::ptrdiff_t {4}, message
+    );
+}
+
+auto main() -> int
+{
+    supl::test_results results;
+
+    const std::vector<int> vec {1, 2, 3, 4};
+    const std::deque<int> deque {1, 2, 3, 4};
+    const std::list<int> list {1, 2, 3, 4};
+
+    enforce_traversal(results, vec, "vector");
+    enforce_traversal(results, deque, "deque");
+    enforce_traversal(results, list, "list");
+
+    // arrow operator
+    const std::map<int, std::string> map {
+      {1, "one"},
+      {2, "two"}
+    };
+    supl::table_iterator map_itr {map.begin()};
+    results.enforce_exactly_equal(map_itr->second, std::string {"one"});
+    ++map_itr;
+    results.enforce_exactly_equal(map_itr->first, 2);
+
+    // writes through non-const iterators
+    std::vector<int> writable {1, 2, 3};
+    const supl::table_iterator writer {writable.begin()};
+    *writer = 42;
+    results.enforce_exactly_equal(writable.front(), 42);
+
+    // different erased types compare unequal
+    const supl::table_iterator<const int> vec_begin {vec.begin()};
+    const supl::table_iterator<const int> list_begin {list.begin()};
+    results.enforce_exactly_equal(vec_begin == list_begin, false);
+    results.enforce_exactly_equal(vec_begin != list_begin, true);
+
+    // reassignment
+    supl::table_iterator<const int> reassigned {vec.begin()};
+    reassigned = list.begin();
+    results.enforce_exactly_equal(reassigned == list_begin, true);
+
+    // heap fallback
+    std::array<int, 3> arr {1, 2, 3};
+    supl::table_iterator<int> big {big_iterator {arr.data()}};
+    results.enforce_exactly_equal(big.is_small_buffered(), false);
+
+    supl::table_iterator<int> big_copy {big};
+    ++big_copy;
+    results.enforce_exactly_equal(*big, 1);
+    results.enforce_exactly_equal(*big_copy, 2);
+
+    const supl::table_iterator<int> big_moved {std::move(big_copy)};
+    results.enforce_exactly_equal(*big_moved, 2);
+    results.enforce_exactly_equal(big_copy.is_null(), true);  // NOLINT
+
+    supl::table_iterator<int> small_moved {writable.begin()};
+    small_moved = std::move(big);
+    results.enforce_exactly_equal(*small_moved, 1);
+    results.enforce_exactly_equal(small_moved.is_small_buffered(), false);
+
+    // null
+    const supl::table_iterator<int> null_itr {};
+    results.enforce_exactly_equal(null_itr.is_null(), true);
+    results.enforce_exactly_equal(small_moved == null_itr, false);
+
+    bool threw {false};
+    try
+    {
+        [[maybe_unused]] auto illegal {*null_itr};
+    }
+    catch ( supl::bad_iterator_access& )
+    {
+        threw = true;
+    }
+    results.enforce_exactly_equal(threw, true, "null dereference");
+
+    return results.print_and_return();
+}
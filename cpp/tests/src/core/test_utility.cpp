@@ -5,6 +5,7 @@
 #include <list>
 #include <map>
 #include <numeric>
+#include <random>
 #include <set>
 #include <sstream>
 #include <type_traits>
@@ -529,6 +530,62 @@ static auto test_stream_adapter() -> supl::test_results
     return results;
 }
 
+static auto test_counter_rng() -> supl::test_results
+{
+    supl::test_results results;
+
+    static_assert(std::is_same_v<
+                  supl::counter_rng::result_type, std::uint64_t>);
+    static_assert(supl::counter_rng::min() == 0);
+    static_assert(supl::counter_rng::max() == UINT64_MAX);
+
+    constexpr auto first_draw {
+      [](const std::uint64_t seed, const std::uint64_t stream)
+      {
+          supl::counter_rng rng {seed, stream};
+          return rng();
+      }
+    };
+
+    static_assert(first_draw(42, 7) == first_draw(42, 7));
+
+    results.enforce_not_equal(
+      first_draw(42, 7), first_draw(42, 8), "Adjacent streams differ"
+    );
+    results.enforce_not_equal(
+      first_draw(42, 7), first_draw(43, 7), "Adjacent seeds differ"
+    );
+
+    {
+        supl::counter_rng rng {1};
+        const auto draw1 {rng()};
+        const auto draw2 {rng()};
+        results.enforce_not_equal(draw1, draw2, "Successive draws differ");
+    }
+
+    {
+        // with a standard distribution, one generator per index
+        std::uniform_real_distribution<double> dist {0.0, 1.0};
+        double sum {0};
+        bool in_range {true};
+
+        for ( std::uint64_t index {0}; index != 10000; ++index )
+        {
+            supl::counter_rng rng {1234, index};
+            const double value {dist(rng)};
+            in_range = in_range && value >= 0.0 && value < 1.0;
+            sum += value;
+        }
+
+        results.enforce_true(in_range, "Distribution stays in range");
+        results.enforce_floating_point_approx(
+          sum / 10000, 0.5, 0.02, "Mean of uniform distribution"
+        );
+    }
+
+    return results;
+}
+
 static auto test_size_t_literals() -> supl::test_results
 {
     supl::test_results results;
@@ -681,6 +738,7 @@ auto test_utility() -> supl::test_section
       &test_ptrdiff_t_literals
     );
     section.add_test("supl::adapted_ostream", &test_adapted_ostream);
+    section.add_test("supl::counter_rng", &test_counter_rng);
 
     return section;
 }
@@ -0,0 +1,10 @@
+#include <vector>
+
+#include "supl/iterators.hpp"
+
+auto main() -> int
+{
+    // bad construction: the range would dangle once the vector is destroyed
+    const supl::any_range<int> range {std::vector<int> {1, 2, 3}};
+    static_cast<void>(range);
+}